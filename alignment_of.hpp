@@ -0,0 +1,26 @@
+#ifndef ALIGNMENT_OF_HPP
+# define ALIGNMENT_OF_HPP
+
+# include <cstddef>
+
+namespace ft
+{
+    /*
+    * the padding inserted before t is its alignment requirement
+    */
+    template <class T>
+    struct alignment_of
+    {
+    private:
+        struct Probe
+        {
+            char    c;
+            T       t;
+        };
+
+    public:
+        static const std::size_t value = sizeof(Probe) - sizeof(T);
+    };
+}
+
+#endif
\ No newline at end of file
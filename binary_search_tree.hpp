@@ -1,665 +1,3170 @@
-#ifndef BINARY_SEARCH_TREE
-# define BINARY_SEARCH_TREE
-
-# include "pair.hpp"
-# include "bidirectional_iterator.hpp"
-# include "reverse_iterator.hpp"
-
-# include <functional>
-# include <iostream>
-
-namespace ft 
-{
-
-    template <class Key, class T>
-    struct Node 
-    {
-		bool			    color;
-		ft::pair<Key, T>	pair;
-		Node*				lChild;
-		Node*				rChild;
-		Node*				parent;
-
-		Node(ft::pair<Key, T> newPair): color(true), pair(newPair), lChild(NULL), rChild(NULL), parent(NULL) {}
-		Node(void): color(false), pair(), lChild(NULL), rChild(NULL), parent(NULL) {}
-};
-
-    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::Node<Key, T> > >
-    class BST
-    {
-    public:
-		typedef Node<Key, T>	Node;
-		typedef Node*			NodePtr;
-		typedef Alloc			allocator_type;
-		typedef Compare			comp_operation;
-
-		template <class U>
-		class BSTIterator : public ft::bidirectional_iterator<U>
-		{
-		private :
-			friend class BST;
-			BST _bst;
-				
-        public:
-			ft::pair<Key, T>&	operator * (void) const 
-            {
-				return (*this->_ptr->pair);
-			}
-
-			ft::pair<Key, T>*	operator -> (void) const 
-            {
-				return  (&(*this->_ptr->pair));
-			}
-
-			BSTIterator& operator++(void) 
-            {
-				NodePtr y;
-
-				if (this->_ptr == this->_bst.maximum(this->_bst.getRoot()))
-                {
-					throw std::exception();
-                }
-                
-                y = this->_bst.minimum(this->_ptr->rChild);
-				if (y != this->_bst._null && y != NULL)
-                {
-					this->_ptr = y;
-                }
-				else if (this->_ptr->parent->rChild != this->_ptr)
-                {
-					this->_ptr = this->_ptr->parent;
-                }
-				else
-                {
-					this->_ptr = this->_ptr->parent->parent;
-                }
-				return (*this);
-			}
-
-			BSTIterator			operator++(int) 
-            {
-				BSTIterator	tmp(*this);
-
-				++(*this);
-				return (tmp);
-			}
-
-			BSTIterator& operator--(void) 
-            {
-				NodePtr		y;
-
-				if (this->_ptr == this->_bst.minimum(this->_bst.getRoot()))
-                {
-					throw std::exception();
-                }
-
-				y = this->_bst.maximum(this->_ptr->lChild);
-				if (y != this->_bst._null && y != NULL)
-                {
-					this->_ptr = y;
-                }
-				else if (this->_ptr->parent->lChild != this->_ptr)
-                {
-					this->_ptr = this->_ptr->parent;
-                }
-				else
-                {
-					this->_ptr = this->_parent->parent;
-                }
-				return (*this);
-			}
-
-			BSTIterator operator--(int) 
-            {
-			    BSTIterator	tmp(*this);
-
-				--(*this);
-				return (tmp);
-			}
-
-		};
-
-		typedef BSTIterator<NodePtr>					iterator;
-		typedef BSTIterator<const NodePtr>				const_iterator;
-		typedef ft::reverse_iterator<iterator>			reverse_iterator;
-		typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
-
-	private:		
-		NodePtr		_root;
-		NodePtr		_null;
-		Compare		_comp;
-		Alloc		_alloc;
-		std::size_t	_size;
-
-	public:
-		BST(const comp_operation& comp = comp_operation(), const allocator_type& alloc = allocator_type());
-
-		BST& operator=(const BST& x);		
-
-		~BST(void);		
-
-		void	clearTree(void);
-		bool	insertNode(ft::pair<const Key, T> newPair);
-		bool	deleteNode(const Key& key);
-		void	insertFix(NodePtr x);
-		void	deleteFix(NodePtr x);
-		void	recolor(NodePtr node);
-		void	leftRotate(NodePtr node);
-		void	rightRotate(NodePtr node);
-
-		NodePtr			minimum(NodePtr x);
-		NodePtr 		maximum(NodePtr x);
-		std::size_t		getSize(void) const;
-		NodePtr			getNull(void) const;
-		NodePtr			getRoot(void) const;
-		iterator		find(const Key& key);
-
-		BST(const comp_operation& comp = comp_operation(), const allocator_type& alloc = allocator_type()): _root(NULL), _comp(comp), _alloc(alloc), _size(0) 
-        {
-			_null = _alloc.allocate(1);
-			_alloc.construct(_null, Node());
-			_null->color = false;
-			_null->lChild = NULL;
-			_null->rChild = NULL;
-			_null->parent = NULL;
-			_root = _null;
-		}
-
-		BST& operator=(const BST& x) 
-        {
-			if (this == &x)
-            {
-				return (*this);
-            }
-			this->_root = x._root;
-			this->_null = x._null;
-			this->_size = x._size;
-			return (*this);
-		}
-
-		~BST(void) 
-        {
-			if (this->_root != NULL)
-            {
-				this->clearTree();
-            }
-		}
-
-		void clearTree(void) 
-        {
-			while (this->_root != this->_null)
-            {
-				deleteNode(this->_root->pair._first);
-            }
-			this->_root = NULL;
-			_alloc.destroy(this->_null);
-		    _alloc.deallocate(this->_null, 1);
-			this->_null = NULL;
-			this->_size = 0;
-		}
-
-		std::size_t getSize(void) const 
-        {
-			return (this->_size);
-		}
-
-		NodePtr	getRoot(void) const 
-        {
-			return (this->_root);
-		}
-
-		NodePtr	getNull(void) const 
-        {
-			return (this->_null);
-		}
-
-		bool insertNode(ft::pair<Key, T> newPair) 
-        {
-			bool isNewNode = false;
-
-			if (this->_root == this->_null) 
-            {
-				NodePtr	newNode = NULL;
-
-				newNode = _alloc.allocate(1);
-				_alloc.construct(newNode, Node(newPair));
-				newNode->lChild = this->_null;
-				newNode->rChild = this->_null;
-				this->_root = newNode;
-				recolor(this->_root);
-				this->_size++;
-				isNewNode = true;
-			}
-			else 
-            {
-				NodePtr	cur = this->_root;
-				NodePtr		ptrParent = NULL;
-				int	dir;
-
-				while (cur != this->_null) 
-                {
-                    if (cur->pair._first == newPair._first)
-                    {
-						return (false);
-                    }
-                    else if (this->_comp(newPair._first, cur->pair._first)) 
-                    {
-						ptrParent = cur;
-						cur = cur->lChild;
-						dir = 0;
-					}
-                    else 
-                    {
-						ptrParent = cur;
-						cur = cur->rChild;
-						dir = 1;
-					}
-				}
-                NodePtr		newNode = NULL;
-
-			    newNode = _alloc.allocate(1);
-			    _alloc.construct(newNode, Node(newPair));
-				newNode->rChild = this->_null;
-				newNode->lChild = this->_null;
-				newNode->parent = ptrParent;
-				if (dir == 0)
-                {
-					ptrParent->lChild = newNode;
-                }
-				else
-                {
-					ptrParent->rChild = newNode;
-                }
-				cur = newNode;
-				this->_size++;
-				isNewNode = true;
-				insertFix(cur);
-				return (isNewNode);
-			}
-		}
-
-		void insertFix(NodePtr x)
-        {
-			NodePtr	gp = NULL;
-			bool	r;
-			bool	uncle = true;
-
-			if (x->parent->parent != NULL) 
-            {
-				gp = x->parent->parent;
-				if (gp->lChild == x->parent)
-                {
-					r = false;
-                }
-				else
-                {
-					r = true;
-                }
-				if ((r && gp->lChild == this->_null) || (!r && gp->rChild == this->_null))
-                {
-					uncle = false;
-                }
-			}
-
-			if (x->parent->color)
-            {
-				if ((r && (gp->lChild != this->_null && gp->lChild->color)) || (!r && (gp->rChild != this->_null && gp->rChild->color))) 
-                {
-					if (gp != this->_root)
-                    {
-						recolor(gp);
-                    }
-					recolor(gp->lChild);
-					recolor(gp->rChild);
-				}
-				else if (!uncle || ((r && !gp->lChild->color) || (!r && !gp->rChild->color))) 
-                {
-					if (r && x->parent->rChild == x) 
-                    {
-						leftRotate(gp);
-						recolor(gp);
-						recolor(x->parent);
-					}
-					else if (r && x->parent->lChild == x) 
-                    {
-						rightRotate(x->parent);
-						leftRotate(gp);
-						recolor(gp);
-						recolor(x);
-					}
-					else if (!r && x->parent->lChild == x) 
-                    {
-						rightRotate(gp);
-						recolor(gp);
-						recolor(x->parent);
-					}
-					else if (!r && x->parent->rChild == x)
-                    {
-						leftRotate(x->parent);
-						rightRotate(gp);
-						recolor(gp);
-						recolor(x);
-					}
-				}
-			}
-	    }
-
-		bool deleteNode(const Key& key) 
-        {
-			NodePtr	cur;
-			NodePtr	y;
-			NodePtr	x;
-			bool	oldColor = true;
-
-			cur = this->_root;
-			if (cur == this->_null || cur == NULL)
-            {
-				return (false);
-            }
-
-			while (cur != this->_null && cur->pair._first != key) 
-            {
-				if (this->_comp(key, cur->pair._first))
-                {
-					cur = cur->lChild;
-                }
-				else
-                {
-					cur = cur->rChild;
-                }
-			}
-			if (cur == this->_null) 
-            {
-			    std::cout << "No occurence found" << std::endl;
-				return (false);
-			}
-
-			if (cur->lChild != this->_null && cur->rChild != this->_null) 
-            {
-				y = minimum(cur->rChild);
-				oldColor = !y->color;
-				if (y->parent == cur) 
-                {
-					cur->rChild = this->_null;
-                }
-				else
-                {
-					y->parent->lChild = y->rChild;
-                }
-				x = y->rChild;
-				if (x == this->_null)
-                {
-					x->parent = y->parent;
-                }
-				cur->pair = y->pair;
-				_alloc.destroy(y);
-				_alloc.deallocate(y, 1);
-			}
-			else if (cur->lChild == this->_null && cur->rChild == this->_null) 
-            {
-				oldColor = !cur->color;
-				if (cur->parent == NULL)
-                {
-					this->_root = this->_null;
-                }
-				else if (cur->parent->lChild == cur) 
-                {
-					cur->parent->lChild = this->_null;
-					x = cur->parent->lChild;
-					x->parent = cur->parent;
-				}
-			    else 
-                {
-					cur->parent->rChild = this->_null;
-					x = cur->parent->rChild;
-					x->parent = cur->parent;
-				}
-				_alloc.destroy(cur);
-				_alloc.deallocate(cur, 1);
-			}
-			else if (cur->lChild != this->_null)
-            {
-				y = cur->lChild;
-				cur->pair = y->pair;
-				cur->lChild = this->_null;
-				x = cur->lChild;
-				x->parent = cur;
-				oldColor = !y->color;
-				_alloc.destroy(y);
-				_alloc.deallocate(y, 1);
-			}
-			else 
-            {
-				y = cur->rChild;
-				cur->pair = y->pair;
-				cur->rChild = this->_null;
-				x = cur->rChild;
-				x->parent = cur;
-				oldColor = !y->color;
-				_alloc.destroy(y);
-				_alloc.deallocate(y, 1);
-			}
-			this->_size--;
-			if (oldColor)
-            {
-				deleteFix(x);
-            }
-			return (true);
-		}
-
-		void deleteFix(NodePtr x)
-        {
-			NodePtr	w;
-
-			while (x != this->_root && !x->color) 
-            {
-				if (x->parent->lChild == x) 
-                {
-					w = x->parent->rChild;
-					if (w->rChild == NULL)
-                    {
-						w->rChild = this->_null;
-                    }
-					if (w->lChild == NULL)
-                    {
-						w->lChild = this->_null;
-                    }
-					if (w->color) 
-                    {
-						recolor(w);
-						x->parent->color = true;
-						leftRotate(x->parent);
-						w = x->parent->rChild;
-                    }
-					else if ((w->rChild != this->_null && !w->rChild->color) && (w->lChild != this->_null && !w->lChild->color)) 
-                    {
-						w->color = true;
-						x = x->parent;
-					}
-				    else if (!w->rChild->color)
-                    {
-						w->lChild->color = false;
-						w->color = true;
-						rightRotate(w);
-						w = x->parent->rChild;
-					}
-					else 
-                    {
-						w->color = x->parent->color;
-						if (x->parent != this->_root)
-                        {
-							x->parent->parent->color = false;
-                        }
-						w->rChild->color = false;
-					    leftRotate(x->parent);
-						x = this->_root;
-					}
-				}
-				else 
-                {
-					w = x->parent->lChild;
-					if (w->color)
-                    {
-						recolor(w);
-						x->parent->color = true;
-						rightRotate(x->parent);
-					    w = x->parent->lChild;
-					}
-					else if (!w->rChild->color && !w->lChild->color) 
-                    {
-					    w->color = true;
-						x = x->parent;
-					}
-					else if (!w->lChild->color) 
-                    {
-						w->rChild->color = false;
-						w->color = true;
-						leftRotate(w);
-						w = x->parent->lChild;
-					}
-					else 
-                    {
-						w->color = x->parent->color;
-						if (x->parent != this->_root)
-                        {
-							x->parent->parent->color = false;
-                        }
-						w->lChild->color = false;
-						rightRotate(x->parent);
-						x = this->_root;
-					}
-				}
-			}
-		    x->color = false;
-		}
-
-		NodePtr	minimum(NodePtr x) 
-        {
-			while (x->lChild != this->_null && x->lChild != NULL) 
-            {
-				x = x->lChild;
-			}
-			return (x);
-		}
-
-		NodePtr	maximum(NodePtr x) 
-        {
-			while (x->rChild != this->_null && x->rChild != NULL)
-            {
-				x = x->rChild;
-            }
-			return (x);
-		}
-
-		void leftRotate(NodePtr x) 
-        {
-		    if (x->rChild == this->_null)
-            {
-				return;
-            }
-
-			NodePtr	y = x->rChild;
-			x->rChild = y->lChild;
-
-			if (x->rChild != this->_null)
-            {
-				x->rChild->parent = x;
-            }
-
-			y->lChild = x;
-			y->parent = x->parent;
-		    if (y->parent == this->_null || y->parent == NULL)
-            {
-				this->_root = y;
-            }
-			else if (y->parent->lChild == x)
-            {
-				y->parent->lChild = y;
-            }
-			else
-            {
-				y->parent->rChild = y;
-            }
-			x->parent = y;
-		}
-
-		void rightRotate(NodePtr x) 
-        {
-		    if (x->lChild == this->_null)
-            {
-				return;
-            }
-
-			NodePtr	y = x->lChild;
-			x->lChild = y->rChild;
-
-			if (x->lChild != this->_null)
-            {
-				x->lChild->parent = x;
-            }
-
-			y->rChild = x;
-			y->parent = x->parent;
-
-			if (y->parent == this->_null || y->parent == NULL)
-            {
-				this->_root = y;
-            }
-			else if (y->parent->lChild == x)
-            {
-				y->parent->lChild = y;
-            }
-			else
-            {
-				y->parent->rChild = y;
-            }
-            x->parent = y;
-		}
-
-		void recolor(NodePtr node) 
-        { 
-            node->color = !node->color; 
-        }
-
-		iterator find(const Key& key) 
-        {
-			iterator	it = this->minimum(this->getRoot());
-
-			while (it->_ptr != this->_null && it->first != key)
-            {
-								it++;
-            }
-			return (it);
-		}
-
-		void printTree(NodePtr root, int space) const 
-        {
-			if (root == this->_null || root == NULL)
-            {
-				return ;
-            }
-			space += 5;
-			printTree(root->rChild, space);
-			std::cout << std::endl;
-			for (int i = 5; i < space; i++)
-            {
-				std::cout << " ";
-            }
-
-			std::string		strCol;
-
-			if (root->color)
-            {
-				strCol = "\033[1;31m";
-            }
-			else
-            {
-				strCol = "\033[0m";
-            }
-			std::cout << strCol << root->pair._second << "\033[0m" << std::endl;
-		    printTree(root->lChild, space);
-		}
-    };
-}
-
+#ifndef BINARY_SEARCH_TREE
+# define BINARY_SEARCH_TREE
+
+# include "pair.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "node_pool.hpp"
+# include "alignment_of.hpp"
+# include "tree_augment.hpp"
+# include "enable_if.hpp"
+# include "is_integral.hpp"
+# include "is_floating_point.hpp"
+
+# include <functional>
+# include <iostream>
+# include <algorithm>
+# include <climits>
+
+# if __cplusplus >= 201103L
+#  include <atomic>
+# endif
+
+namespace ft 
+{
+
+	/*
+	* packed layout: the colour (true for red) lives in the low bit of the
+	* parent link, which is always free since nodes are at least pointer
+	* aligned, so the node is the pair plus three words
+	* the fixup code only goes through getParent / getColor and their setters
+	* the augmentation data (nothing by default) is an empty-able base
+	*/
+    template <class Key, class T, class Augment = ft::no_augment, bool Packed = (ft::alignment_of<void*>::value > 1)>
+    struct Node: public Augment::node_data
+    {
+		ft::pair<Key, T>	pair;
+		Node*				lChild;
+		Node*				rChild;
+		std::size_t			parentColor;
+
+		Node(const ft::pair<Key, T>& newPair): pair(newPair), lChild(NULL), rChild(NULL), parentColor(1) {}
+		Node(void): pair(), lChild(NULL), rChild(NULL), parentColor(0) {}
+
+		Node*	getParent(void) const
+		{
+			return (reinterpret_cast<Node*>(this->parentColor & ~static_cast<std::size_t>(1)));
+		}
+
+		void	setParent(Node* parent)
+		{
+			this->parentColor = reinterpret_cast<std::size_t>(parent) | (this->parentColor & 1);
+		}
+
+		bool	getColor(void) const
+		{
+			return (this->parentColor & 1);
+		}
+
+		void	setColor(bool color)
+		{
+			this->parentColor = (this->parentColor & ~static_cast<std::size_t>(1)) | static_cast<std::size_t>(color);
+		}
+};
+
+    template <class Key, class T, class Augment>
+    struct Node<Key, T, Augment, false>: public Augment::node_data
+    {
+		bool			    color;
+		ft::pair<Key, T>	pair;
+		Node*				lChild;
+		Node*				rChild;
+		Node*				parent;
+
+		Node(const ft::pair<Key, T>& newPair): color(true), pair(newPair), lChild(NULL), rChild(NULL), parent(NULL) {}
+		Node(void): color(false), pair(), lChild(NULL), rChild(NULL), parent(NULL) {}
+
+		Node*	getParent(void) const
+		{
+			return (this->parent);
+		}
+
+		void	setParent(Node* parent)
+		{
+			this->parent = parent;
+		}
+
+		bool	getColor(void) const
+		{
+			return (this->color);
+		}
+
+		void	setColor(bool color)
+		{
+			this->color = color;
+		}
+};
+
+	/*
+	* Compare is std::less or std::greater on an arithmetic Key: the tree
+	* then compares keys itself (see BST::nativeLowerBound)
+	*/
+	template <class Key, class Compare>
+	struct native_order
+	{
+		static const bool value = false;
+	};
+
+	template <class Key>
+	struct native_order<Key, std::less<Key> >
+	{
+		static const bool value = ft::is_integral<Key>::value || ft::is_floating_point<Key>::value;
+
+		static bool less(Key a, Key b)
+		{
+			return (a < b);
+		}
+	};
+
+	template <class Key>
+	struct native_order<Key, std::greater<Key> >
+	{
+		static const bool value = ft::is_integral<Key>::value || ft::is_floating_point<Key>::value;
+
+		static bool less(Key a, Key b)
+		{
+			return (a > b);
+		}
+	};
+
+	/*
+	* layout:
+	* leaves are NULL, the root's parent is the header node
+	* _header->parent is the root, _header->lChild the leftmost node and
+	* _header->rChild the rightmost one, so begin() and end() are O(1)
+	* the header is the end() node, it is kept red to tell it from the root
+	* it is part of the tree object, so an empty tree allocates nothing
+	* Augment (see tree_augment.hpp) is kept up to date on every node but
+	* the header
+	*/
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::Node<Key, T> >, class Augment = ft::no_augment>
+    class BST
+    {
+    public:
+		typedef ft::Node<Key, T, Augment>	Node;
+		typedef Node*			NodePtr;
+		typedef Alloc			allocator_type;
+		typedef Compare			comp_operation;
+
+		/*
+		* U is the (possibly const) value type, the iterator only holds the
+		* node it points to
+		*/
+		template <class U>
+		class BSTIterator
+		{
+		public:
+			typedef U									value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef U*									pointer;
+			typedef U&									reference;
+			typedef ft::bidirectional_iterator_tag		iterator_category;
+
+		private :
+			friend class BST;
+			NodePtr	_ptr;
+
+        public:
+			BSTIterator(void): _ptr(NULL) {}
+
+			explicit BSTIterator(NodePtr node): _ptr(node) {}
+
+			template <class V>
+			BSTIterator(const BSTIterator<V>& x): _ptr(x.getNode()) {}
+
+			NodePtr	getNode(void) const
+			{
+				return (this->_ptr);
+			}
+
+			reference	operator * (void) const
+            {
+				return (this->_ptr->pair);
+			}
+
+			pointer	operator -> (void) const
+            {
+				return (&this->_ptr->pair);
+			}
+
+			BSTIterator& operator++(void) 
+            {
+				this->_ptr = BST::successor(this->_ptr);
+				return (*this);
+			}
+
+			BSTIterator			operator++(int) 
+            {
+				BSTIterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			BSTIterator& operator--(void) 
+            {
+				this->_ptr = BST::predecessor(this->_ptr);
+				return (*this);
+			}
+
+			BSTIterator operator--(int) 
+            {
+			    BSTIterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			template <class V>
+			bool operator==(const BSTIterator<V>& rhs) const
+			{
+				return (this->_ptr == rhs.getNode());
+			}
+
+			template <class V>
+			bool operator!=(const BSTIterator<V>& rhs) const
+			{
+				return (this->_ptr != rhs.getNode());
+			}
+		};
+
+		typedef BSTIterator<ft::pair<Key, T> >			iterator;
+		typedef BSTIterator<const ft::pair<Key, T> >	const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+	private:		
+		Node		_headerNode;
+		NodePtr		_header;
+		Compare		_comp;
+		Alloc		_alloc;
+		ft::node_pool<Node, Alloc>	_pool;
+		mutable std::size_t			_size;
+
+		static const std::size_t	_unknownSize = static_cast<std::size_t>(-1);
+		static const std::size_t	_batchWidth = 16;
+		static const std::size_t	_linearErase = 32;
+
+	public:
+		BST(const comp_operation& comp = comp_operation(), const allocator_type& alloc = allocator_type()):
+			_headerNode(), _header(&_headerNode), _comp(comp), _alloc(alloc), _pool(alloc), _size(0)
+        {
+			_header->setColor(true);
+			_header->lChild = _header;
+			_header->rChild = _header;
+		}
+
+		/*
+		* copies are structural: x's topology and colours are cloned node for
+		* node in a single pass, no comparison nor rebalancing is involved
+		*/
+		BST(const BST& x): _headerNode(), _header(&_headerNode), _comp(x._comp), _alloc(x._alloc), _pool(x._alloc), _size(0)
+        {
+			_header->setColor(true);
+			_header->lChild = _header;
+			_header->rChild = _header;
+			_pool.reserve(x.getSize());
+			this->cloneTree(x);
+		}
+
+		BST& operator=(const BST& x) 
+        {
+			if (this == &x)
+            {
+				return (*this);
+            }
+			this->clearTree();
+			this->_comp = x._comp;
+			this->cloneTree(x);
+			return (*this);
+		}
+
+# if __cplusplus >= 201103L
+		BST(BST&& x): BST(x._comp, x._alloc)
+        {
+			this->swap(x);
+		}
+
+		BST& operator=(BST&& x)
+        {
+			this->swap(x);
+			return (*this);
+		}
+# endif
+
+		/*
+		* nodes never move: the headers exchange their links, size,
+		* comparator and the pool owning the nodes are exchanged
+		*/
+		void swap(BST& x)
+        {
+			NodePtr	root = this->getRoot();
+			NodePtr	leftmost = this->getLeftmost();
+			NodePtr	rightmost = this->getRightmost();
+
+			this->setHeader(x.getRoot(), x.getLeftmost(), x.getRightmost());
+			x.setHeader(root, leftmost, rightmost);
+			std::swap(this->_size, x._size);
+			std::swap(this->_comp, x._comp);
+			std::swap(this->_alloc, x._alloc);
+			this->_pool.swap(x._pool);
+		}
+
+		/*
+		* the whole pool goes away with the tree: payloads are destroyed but
+		* slots aren't put back on the free list, the slabs are released at once
+		* (those sealed into an arena other trees refer to stay with them)
+		*/
+		~BST(void) 
+        {
+			this->destroySubtree(this->getRoot(), false);
+			_pool.release();
+		}
+
+		void clearTree(void) 
+        {
+			this->destroySubtree(this->getRoot(), true);
+			this->_header->setParent(NULL);
+			this->_header->lChild = this->_header;
+			this->_header->rChild = this->_header;
+			this->_size = 0;
+		}
+
+		/*
+		* linear construction of an empty tree from [first, last), sorted by
+		* _comp and holding n distinct keys (equal keys may follow each other,
+		* the first one is kept)
+		* subtrees are split around their middle element so every leaf sits
+		* on one of the two last levels, nodes of the last, incomplete, level
+		* are red and all the others black
+		*/
+		template <class ForwardIterator>
+		void buildSorted(ForwardIterator first, ForwardIterator last, std::size_t n)
+        {
+			std::size_t	fullLevels = 0;
+			NodePtr		root;
+
+			if (n == 0)
+            {
+				return ;
+            }
+			while ((static_cast<std::size_t>(2) << fullLevels) - 1 <= n)
+            {
+				fullLevels++;
+            }
+			this->_pool.reserve(n);
+			root = this->buildSubtree(first, last, n, 0, fullLevels);
+			root->setParent(this->_header);
+			this->_header->setParent(root);
+			this->_header->lChild = minimum(root);
+			this->_header->rChild = maximum(root);
+			this->_size = n;
+		}
+
+		/*
+		* same input as buildSorted, into a tree that may hold elements
+		* already: the input is built into a detached subtree first, whose
+		* nodes are then spliced in by uniteOwned, keys already present keep
+		* their element and the built node is released
+		*/
+		template <class ForwardIterator>
+		void uniteSorted(ForwardIterator first, ForwardIterator last, std::size_t n)
+        {
+			std::size_t	fullLevels = 0;
+			NodePtr		root;
+			Subtree		t;
+
+			if (this->getRoot() == NULL)
+            {
+				this->buildSorted(first, last, n);
+				return ;
+            }
+			if (n == 0)
+            {
+				return ;
+            }
+			while ((static_cast<std::size_t>(2) << fullLevels) - 1 <= n)
+            {
+				fullLevels++;
+            }
+			this->_pool.reserve(n);
+			root = this->buildSubtree(first, last, n, 0, fullLevels);
+			t = this->detachRoot();
+			this->attachRoot(this->uniteOwned(t, root, fullLevels));
+		}
+
+		void reserve(std::size_t n)
+        {
+			this->_pool.reserve(n);
+		}
+
+		/*
+		* split and extraction leave the sizes of both trees unknown, unless
+		* the augmentation keeps subtree sizes, they are then counted on the
+		* first call
+		*/
+		std::size_t getSize(void) const 
+        {
+			if (this->_size == _unknownSize)
+            {
+				this->_size = countNodes(this->getRoot());
+            }
+			return (this->_size);
+		}
+
+		NodePtr	getRoot(void) const 
+        {
+			return (this->_header->getParent());
+		}
+
+		NodePtr	getHeader(void) const
+        {
+			return (this->_header);
+		}
+
+		NodePtr	getLeftmost(void) const
+        {
+			return (this->_header->lChild);
+		}
+
+		NodePtr	getRightmost(void) const
+        {
+			return (this->_header->rChild);
+		}
+
+		/*
+		* single descent: returns the node holding key, or NULL and the leaf
+		* slot (parent + side) where a node for key has to be attached
+		*/
+		NodePtr insertPosition(const Key& key, NodePtr& parent, bool& left) const
+        {
+			return (this->nativeInsertPosition<Compare>(key, parent, left));
+		}
+
+		/*
+		* same descent without branches for the native orders: the side
+		* taken only selects between pointers already loaded
+		*/
+		template <class C>
+		typename ft::enable_if<ft::native_order<Key, C>::value, NodePtr>::type nativeInsertPosition(const Key& key, NodePtr& parent, bool& left) const
+        {
+			NodePtr	cur = this->getRoot();
+			NodePtr	notGreater = NULL;
+
+			parent = NULL;
+			left = true;
+			while (cur != NULL)
+            {
+				parent = cur;
+				left = ft::native_order<Key, C>::less(key, cur->pair._first);
+				notGreater = pick(cur, notGreater, left);
+				cur = pick(cur->rChild, cur->lChild, left);
+			}
+			if (notGreater != NULL && !ft::native_order<Key, C>::less(notGreater->pair._first, key))
+            {
+				return (notGreater);
+            }
+			return (NULL);
+		}
+
+		template <class C>
+		typename ft::enable_if<!ft::native_order<Key, C>::value, NodePtr>::type nativeInsertPosition(const Key& key, NodePtr& parent, bool& left) const
+        {
+			NodePtr	cur = this->getRoot();
+			NodePtr	notGreater = NULL;
+
+			parent = NULL;
+			left = true;
+			while (cur != NULL)
+            {
+				parent = cur;
+				left = this->_comp(key, cur->pair._first);
+				if (left)
+                {
+					cur = cur->lChild;
+                }
+				else
+                {
+					notGreater = cur;
+					cur = cur->rChild;
+                }
+			}
+			if (notGreater != NULL && !this->_comp(notGreater->pair._first, key))
+            {
+				return (notGreater);
+            }
+			return (NULL);
+		}
+
+		NodePtr attachNode(NodePtr parent, bool left, const ft::pair<Key, T>& newPair)
+        {
+			NodePtr	newNode = NULL;
+
+			newNode = _pool.allocate();
+			_alloc.construct(newNode, Node(newPair));
+			return (this->linkNode(parent, left, newNode));
+		}
+
+		/*
+		* attaches a detached node (fresh or coming from another tree whose
+		* pool this one adopted) at the slot found by insertPosition
+		*/
+		NodePtr linkNode(NodePtr parent, bool left, NodePtr newNode)
+        {
+			newNode->lChild = NULL;
+			newNode->rChild = NULL;
+			newNode->setColor(true);
+			Augment::update(newNode);
+			this->growSize(1);
+			if (parent == NULL)
+            {
+				newNode->setParent(this->_header);
+				this->_header->setParent(newNode);
+				this->_header->lChild = newNode;
+				this->_header->rChild = newNode;
+				recolor(newNode);
+				return (newNode);
+            }
+			newNode->setParent(parent);
+			if (left)
+            {
+				parent->lChild = newNode;
+				if (parent == this->_header->lChild)
+                {
+					this->_header->lChild = newNode;
+                }
+            }
+			else
+            {
+				parent->rChild = newNode;
+				if (parent == this->_header->rChild)
+                {
+					this->_header->rChild = newNode;
+                }
+            }
+			this->updatePath(parent);
+			insertFix(newNode);
+			return (newNode);
+		}
+
+		ft::pair<NodePtr, bool> insertNode(const ft::pair<Key, T>& newPair) 
+        {
+			NodePtr	parent;
+			bool	left;
+			NodePtr	found = this->insertPosition(newPair._first, parent, left);
+
+			if (found != NULL)
+            {
+				return (ft::make_pair(found, false));
+            }
+			return (ft::make_pair(this->attachNode(parent, left, newPair), true));
+		}
+
+		/*
+		* node handles: node has to come from a tree sharing this pool
+		*/
+		ft::pair<NodePtr, bool> insertNode(NodePtr node)
+        {
+			NodePtr	parent;
+			bool	left;
+			NodePtr	found = this->insertPosition(node->pair._first, parent, left);
+
+			if (found != NULL)
+            {
+				return (ft::make_pair(found, false));
+            }
+			return (ft::make_pair(this->linkNode(parent, left, node), true));
+		}
+
+		/*
+		* hinted insertion: when newPair belongs right before or right after
+		* position, it is linked into the free child slot next to it without
+		* descending from the root, otherwise this falls back to insertNode
+		*/
+
+		ft::pair<NodePtr, bool> insertNode(iterator position, const ft::pair<Key, T>& newPair)
+        {
+			NodePtr	hint = position._ptr;
+			NodePtr	other;
+
+			if (this->getRoot() == NULL)
+            {
+				return (this->insertNode(newPair));
+            }
+			if (hint == this->_header)
+            {
+				other = this->_header->rChild;
+				if (this->_comp(other->pair._first, newPair._first))
+                {
+					return (ft::make_pair(this->attachNode(other, false, newPair), true));
+                }
+				return (this->insertNode(newPair));
+            }
+			if (this->_comp(newPair._first, hint->pair._first))
+            {
+				if (hint == this->_header->lChild)
+                {
+					return (ft::make_pair(this->attachNode(hint, true, newPair), true));
+                }
+				other = predecessor(hint);
+				if (this->_comp(other->pair._first, newPair._first))
+                {
+					if (other->rChild == NULL)
+                    {
+						return (ft::make_pair(this->attachNode(other, false, newPair), true));
+                    }
+					return (ft::make_pair(this->attachNode(hint, true, newPair), true));
+                }
+				return (this->insertNode(newPair));
+            }
+			if (this->_comp(hint->pair._first, newPair._first))
+            {
+				if (hint == this->_header->rChild)
+                {
+					return (ft::make_pair(this->attachNode(hint, false, newPair), true));
+                }
+				other = successor(hint);
+				if (this->_comp(newPair._first, other->pair._first))
+                {
+					if (hint->rChild == NULL)
+                    {
+						return (ft::make_pair(this->attachNode(hint, false, newPair), true));
+                    }
+					return (ft::make_pair(this->attachNode(other, true, newPair), true));
+                }
+				return (this->insertNode(newPair));
+            }
+			return (ft::make_pair(hint, false));
+		}
+
+		void insertFix(NodePtr x)
+        {
+			NodePtr	gp;
+			NodePtr	uncle;
+
+			while (x != this->getRoot() && x->getParent()->getColor())
+            {
+				gp = x->getParent()->getParent();
+				if (x->getParent() == gp->lChild)
+                {
+					uncle = gp->rChild;
+					if (uncle != NULL && uncle->getColor())
+                    {
+						recolor(x->getParent());
+						recolor(uncle);
+						recolor(gp);
+						x = gp;
+                    }
+					else 
+                    {
+						if (x == x->getParent()->rChild)
+                        {
+							x = x->getParent();
+							leftRotate(x);
+                        }
+						recolor(x->getParent());
+						recolor(gp);
+						rightRotate(gp);
+                    }
+                }
+				else
+                {
+					uncle = gp->lChild;
+					if (uncle != NULL && uncle->getColor())
+                    {
+						recolor(x->getParent());
+						recolor(uncle);
+						recolor(gp);
+						x = gp;
+                    }
+					else 
+                    {
+						if (x == x->getParent()->lChild)
+                        {
+							x = x->getParent();
+							rightRotate(x);
+                        }
+						recolor(x->getParent());
+						recolor(gp);
+						leftRotate(gp);
+                    }
+                }
+			}
+			this->getRoot()->setColor(false);
+	    }
+
+		/*
+		* payloads never move: the node holding key is unlinked by
+		* unlinkNode, its successor taking its place in the tree when it
+		* has two children, so iterators to the other elements stay valid
+		*/
+		template <class K>
+		bool deleteNode(const K& key) 
+        {
+			NodePtr	cur = this->searchNode(key);
+
+			if (cur == this->_header)
+            {
+				return (false);
+			}
+			this->eraseNode(cur);
+			return (true);
+		}
+
+		/*
+		* erase through an iterator: z is unlinked where it is, no search
+		*/
+		void eraseNode(NodePtr z)
+        {
+			this->unlinkNode(z);
+			_alloc.destroy(z);
+			_pool.deallocate(z);
+		}
+
+		/*
+		* erases [first, last) in O(k + log n): short ranges are erased node
+		* by node (the successor is taken before its predecessor goes away),
+		* longer ones are cut out with two splits and a join and the
+		* detached subtree is destroyed in one pass
+		*/
+		void eraseRange(NodePtr first, NodePtr last)
+        {
+			NodePtr		next = first;
+			std::size_t	k = 0;
+			Subtree		l;
+			Subtree		mid;
+			Subtree		r;
+			NodePtr		m;
+
+			if (first == this->getLeftmost() && last == this->_header)
+            {
+				this->clearTree();
+				return ;
+            }
+			while (next != last && k < _linearErase)
+            {
+				next = successor(next);
+				k++;
+            }
+			if (next == last)
+            {
+				while (first != last)
+                {
+					next = successor(first);
+					this->eraseNode(first);
+					first = next;
+                }
+				return ;
+            }
+			this->splitSubtree(this->detachRoot(), first->pair._first, l, m, r);
+			mid = r;
+			r = makeSubtree(NULL, 0);
+			if (last != this->_header)
+            {
+				this->splitSubtree(mid, last->pair._first, mid, m, r);
+				r = this->joinSubtrees(makeSubtree(NULL, 0), m, r);
+            }
+			this->attachRoot(this->joinSubtrees(l, r));
+			this->shrinkSize(countNodes(mid.root) + 1);
+			this->destroySubtree(mid.root, true);
+			_alloc.destroy(first);
+			_pool.deallocate(first);
+		}
+
+		/*
+		* unlinks z without touching any payload: when z has two children its
+		* successor takes its place (links and colour), other nodes keep
+		* their keys and positions
+		* z comes back detached, still constructed, for a node handle
+		*/
+		NodePtr unlinkNode(NodePtr z)
+        {
+			NodePtr	y = z;
+			NodePtr	x;
+			NodePtr	xParent;
+			bool	removedBlack;
+
+			if (z == this->_header->lChild)
+            {
+				this->_header->lChild = (z->rChild != NULL) ? minimum(z->rChild) : z->getParent();
+            }
+			if (z == this->_header->rChild)
+            {
+				this->_header->rChild = (z->lChild != NULL) ? maximum(z->lChild) : z->getParent();
+            }
+			if (z->lChild != NULL && z->rChild != NULL)
+            {
+				y = minimum(z->rChild);
+            }
+			x = (y->lChild != NULL) ? y->lChild : y->rChild;
+			removedBlack = !y->getColor();
+			if (y == z)
+            {
+				xParent = z->getParent();
+				this->transplant(z, x);
+            }
+			else
+            {
+				if (y == z->rChild)
+                {
+					xParent = y;
+                }
+				else
+                {
+					xParent = y->getParent();
+					this->transplant(y, x);
+					y->rChild = z->rChild;
+					y->rChild->setParent(y);
+                }
+				this->transplant(z, y);
+				y->lChild = z->lChild;
+				y->lChild->setParent(y);
+				y->setColor(z->getColor());
+            }
+			this->shrinkSize(1);
+			this->updatePath(xParent);
+			if (removedBlack)
+            {
+				deleteFix(x, xParent);
+            }
+			z->lChild = NULL;
+			z->rChild = NULL;
+			z->setParent(NULL);
+			return (z);
+		}
+
+		/*
+		* puts v (possibly NULL) where u is under u's parent
+		*/
+		void transplant(NodePtr u, NodePtr v)
+        {
+			NodePtr	parent = u->getParent();
+
+			if (parent == this->_header)
+            {
+				this->_header->setParent(v);
+            }
+			else if (parent->lChild == u)
+            {
+				parent->lChild = v;
+            }
+			else
+            {
+				parent->rChild = v;
+            }
+			if (v != NULL)
+            {
+				v->setParent(parent);
+            }
+		}
+
+		/*
+		* moves every node of x whose key is missing here, no allocation
+		*/
+		void mergeFrom(BST& x)
+        {
+			NodePtr	node;
+			NodePtr	next;
+			NodePtr	parent;
+			bool	left;
+
+			if (this == &x || x.getRoot() == NULL)
+            {
+				return ;
+            }
+			this->_pool.adopt(x._pool);
+			for (node = x.getLeftmost(); node != x._header; node = next)
+            {
+				next = successor(node);
+				if (this->insertPosition(node->pair._first, parent, left) == NULL)
+                {
+					this->linkNode(parent, left, x.unlinkNode(node));
+                }
+            }
+		}
+
+		/*
+		* node handles: adoptPool before linking a node taken from pool,
+		* lendPool before pool takes one of this tree's nodes
+		*/
+		template <class Pool>
+		void adoptPool(Pool& pool)
+        {
+			this->_pool.adopt(pool);
+		}
+
+		template <class Pool>
+		void lendPool(Pool& pool)
+        {
+			pool.adopt(this->_pool);
+		}
+
+		/*
+		* x carries the extra black, it may be NULL hence xParent
+		*/
+		void deleteFix(NodePtr x, NodePtr xParent)
+        {
+			NodePtr	w;
+
+			while (x != this->getRoot() && (x == NULL || !x->getColor()))
+            {
+				if (xParent->lChild == x)
+                {
+					w = xParent->rChild;
+					if (w->getColor())
+                    {
+						recolor(w);
+						recolor(xParent);
+						leftRotate(xParent);
+						w = xParent->rChild;
+                    }
+					if ((w->lChild == NULL || !w->lChild->getColor()) && (w->rChild == NULL || !w->rChild->getColor()))
+                    {
+						w->setColor(true);
+						x = xParent;
+						xParent = xParent->getParent();
+					}
+				    else
+                    {
+						if (w->rChild == NULL || !w->rChild->getColor())
+						{
+							w->lChild->setColor(false);
+							w->setColor(true);
+							rightRotate(w);
+							w = xParent->rChild;
+						}
+						w->setColor(xParent->getColor());
+						xParent->setColor(false);
+						w->rChild->setColor(false);
+						leftRotate(xParent);
+						x = this->getRoot();
+					}
+				}
+				else
+                {
+					w = xParent->lChild;
+					if (w->getColor())
+                    {
+						recolor(w);
+						recolor(xParent);
+						rightRotate(xParent);
+					    w = xParent->lChild;
+					}
+					if ((w->rChild == NULL || !w->rChild->getColor()) && (w->lChild == NULL || !w->lChild->getColor()))
+                    {
+					    w->setColor(true);
+						x = xParent;
+						xParent = xParent->getParent();
+					}
+					else 
+                    {
+						if (w->lChild == NULL || !w->lChild->getColor())
+						{
+							w->rChild->setColor(false);
+							w->setColor(true);
+							leftRotate(w);
+							w = xParent->lChild;
+						}
+						w->setColor(xParent->getColor());
+						xParent->setColor(false);
+						w->lChild->setColor(false);
+						rightRotate(xParent);
+						x = this->getRoot();
+					}
+				}
+			}
+			if (x != NULL)
+            {
+			    x->setColor(false);
+            }
+		}
+
+		static NodePtr	minimum(NodePtr x)
+        {
+			while (x->lChild != NULL)
+            {
+				x = x->lChild;
+			}
+			return (x);
+		}
+
+		static NodePtr	maximum(NodePtr x)
+        {
+			while (x->rChild != NULL)
+            {
+				x = x->rChild;
+            }
+			return (x);
+		}
+
+		/*
+		* in-order neighbours, successor of the rightmost node is the header
+		* and predecessor of the header is the rightmost node
+		*/
+		static NodePtr	successor(NodePtr x)
+        {
+			NodePtr	y;
+
+			if (x->rChild != NULL)
+            {
+				return (minimum(x->rChild));
+            }
+			y = x->getParent();
+			while (x == y->rChild)
+            {
+				x = y;
+				y = y->getParent();
+            }
+			if (x->rChild != y)
+            {
+				x = y;
+            }
+			return (x);
+		}
+
+		static NodePtr	predecessor(NodePtr x)
+        {
+			NodePtr	y;
+
+			if (x->getColor() && (x->getParent() == NULL || x->getParent()->getParent() == x))
+            {
+				return (x->rChild);
+            }
+			if (x->lChild != NULL)
+            {
+				return (maximum(x->lChild));
+            }
+			y = x->getParent();
+			while (x == y->lChild)
+            {
+				x = y;
+				y = y->getParent();
+            }
+			return (y);
+		}
+
+		void leftRotate(NodePtr x) 
+        {
+			NodePtr	y = x->rChild;
+
+			x->rChild = y->lChild;
+			if (x->rChild != NULL)
+            {
+				x->rChild->setParent(x);
+            }
+			y->setParent(x->getParent());
+		    if (x == this->getRoot())
+            {
+				this->_header->setParent(y);
+            }
+			else if (x->getParent()->lChild == x)
+            {
+				x->getParent()->lChild = y;
+            }
+			else
+            {
+				x->getParent()->rChild = y;
+            }
+			y->lChild = x;
+			x->setParent(y);
+			Augment::update(x);
+			Augment::update(y);
+		}
+
+		void rightRotate(NodePtr x) 
+        {
+			NodePtr	y = x->lChild;
+
+			x->lChild = y->rChild;
+			if (x->lChild != NULL)
+            {
+				x->lChild->setParent(x);
+            }
+			y->setParent(x->getParent());
+		    if (x == this->getRoot())
+            {
+				this->_header->setParent(y);
+            }
+			else if (x->getParent()->lChild == x)
+            {
+				x->getParent()->lChild = y;
+            }
+			else
+            {
+				x->getParent()->rChild = y;
+            }
+			y->rChild = x;
+            x->setParent(y);
+			Augment::update(x);
+			Augment::update(y);
+		}
+
+		void recolor(NodePtr node) 
+        {
+            node->setColor(!node->getColor()); 
+        }
+
+		/*
+		* root-to-leaf descent using only _comp: keeps the last node whose key
+		* is not less than the searched one, so one comparison is made per level
+		* the lookups take any K that _comp compares with Key, the map only
+		* passes something else than a Key with a transparent comparator
+		*/
+		template <class K>
+		NodePtr lowerBound(const K& key) const
+        {
+			return (this->lowerBoundFrom(this->getRoot(), key, this->_header));
+		}
+
+		/*
+		* same descent in the subtree of x, res being the answer if no node
+		* of the subtree qualifies
+		*/
+		template <class K>
+		NodePtr lowerBoundFrom(NodePtr x, const K& key, NodePtr res) const
+        {
+			while (x != NULL)
+            {
+				if (!this->_comp(x->pair._first, key))
+                {
+					res = x;
+					x = x->lChild;
+                }
+				else
+                {
+					x = x->rChild;
+                }
+            }
+			return (res);
+		}
+
+		/*
+		* a Key goes through nativeLowerBound, which is branchless for the
+		* native orders and the loop above otherwise
+		*/
+		NodePtr lowerBoundFrom(NodePtr x, const Key& key, NodePtr res) const
+        {
+			return (this->nativeLowerBound<Compare>(x, key, res));
+		}
+
+		template <class C>
+		typename ft::enable_if<ft::native_order<Key, C>::value, NodePtr>::type nativeLowerBound(NodePtr x, const Key& key, NodePtr res) const
+        {
+			bool	right;
+
+			while (x != NULL)
+            {
+				right = ft::native_order<Key, C>::less(x->pair._first, key);
+				res = pick(x, res, right);
+				x = pick(x->lChild, x->rChild, right);
+            }
+			return (res);
+		}
+
+		template <class C>
+		typename ft::enable_if<!ft::native_order<Key, C>::value, NodePtr>::type nativeLowerBound(NodePtr x, const Key& key, NodePtr res) const
+        {
+			return (this->template lowerBoundFrom<Key>(x, key, res));
+		}
+
+		/*
+		* r when right, l otherwise, through a mask rather than a jump
+		*/
+		static NodePtr pick(NodePtr l, NodePtr r, bool right)
+        {
+			std::size_t	mask = -static_cast<std::size_t>(right);
+
+			return (reinterpret_cast<NodePtr>((reinterpret_cast<std::size_t>(l) & ~mask) | (reinterpret_cast<std::size_t>(r) & mask)));
+		}
+
+		/*
+		* finger search: climbs from finger (a node of this tree, the header
+		* or NULL for none) until the ancestors bracket key, then descends
+		* between them
+		* when key is above the finger, only the ancestors reached from
+		* their left are compared: the climb stops at the first one not
+		* below key, and every key between it and the last one below key
+		* sits in the right subtree of the latter, symmetrically when key
+		* is below the finger; nothing outside the two is compared, a
+		* search d keys away from the finger costs O(log d) on average
+		*/
+		template <class K>
+		NodePtr fingerLowerBound(NodePtr finger, const K& key) const
+        {
+			NodePtr	root = this->getRoot();
+			NodePtr	x = finger;
+			NodePtr	last = finger;
+			NodePtr	parent;
+
+			if (finger == NULL || finger == this->_header)
+            {
+				return (this->lowerBound(key));
+            }
+			if (this->_comp(finger->pair._first, key))
+            {
+				while (x != root)
+                {
+					parent = x->getParent();
+					if (x == parent->lChild)
+                    {
+						if (!this->_comp(parent->pair._first, key))
+                        {
+							return (this->lowerBoundFrom(last->rChild, key, parent));
+                        }
+						last = parent;
+                    }
+					x = parent;
+                }
+				return (this->lowerBoundFrom(last->rChild, key, this->_header));
+            }
+			if (!this->_comp(key, finger->pair._first))
+            {
+				return (finger);
+            }
+			while (x != root)
+            {
+				parent = x->getParent();
+				if (x == parent->rChild)
+                {
+					if (this->_comp(parent->pair._first, key))
+                    {
+						break ;
+                    }
+					last = parent;
+                }
+				x = parent;
+            }
+			return (this->lowerBoundFrom(last->lChild, key, last));
+		}
+
+		/*
+		* insertPosition through the finger: a missing key goes right before
+		* its lower bound, in the free left slot of the lower bound or the
+		* free right slot of its predecessor
+		*/
+		NodePtr fingerInsertPosition(NodePtr finger, const Key& key, NodePtr& parent, bool& left) const
+        {
+			NodePtr	next = this->fingerLowerBound(finger, key);
+
+			if (next != this->_header && !this->_comp(key, next->pair._first))
+            {
+				return (next);
+            }
+			parent = NULL;
+			left = true;
+			if (this->getRoot() == NULL)
+            {
+				return (NULL);
+            }
+			if (next == this->_header)
+            {
+				parent = this->_header->rChild;
+				left = false;
+            }
+			else if (next->lChild == NULL)
+            {
+				parent = next;
+            }
+			else
+            {
+				parent = maximum(next->lChild);
+				left = false;
+            }
+			return (NULL);
+		}
+
+		template <class K>
+		NodePtr upperBound(const K& key) const
+        {
+			NodePtr	cur = this->getRoot();
+			NodePtr	res = this->_header;
+
+			while (cur != NULL)
+            {
+				if (this->_comp(key, cur->pair._first))
+                {
+					res = cur;
+					cur = cur->lChild;
+                }
+				else
+                {
+					cur = cur->rChild;
+                }
+            }
+			return (res);
+		}
+
+		template <class K>
+		NodePtr searchNode(const K& key) const
+        {
+			NodePtr	res = this->lowerBound(key);
+
+			if (res == this->_header || this->_comp(key, res->pair._first))
+            {
+				return (this->_header);
+            }
+			return (res);
+		}
+
+		template <class K>
+		iterator find(const K& key) 
+        {
+			return (iterator(this->searchNode(key)));
+		}
+
+		/*
+		* batched lookups: the keys go by groups of _batchWidth whose
+		* descents advance one level at a time in turn, each lane prefetches
+		* its next node and only reads it once the other lanes have made
+		* their step, so the cache misses of a group overlap instead of
+		* adding up on trees that do not fit in cache
+		* writes an Iterator to the node of each key, or to the header, in
+		* the order of the keys
+		*/
+		template <class Iterator, class ForwardIterator, class OutputIterator>
+		OutputIterator findBatch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        {
+			ForwardIterator	keys[_batchWidth];
+			NodePtr			cur[_batchWidth];
+			NodePtr			res[_batchWidth];
+			std::size_t		n;
+			std::size_t		active;
+			std::size_t		i;
+
+			while (first != last)
+            {
+				for (n = 0; n < _batchWidth && first != last; ++n, ++first)
+                {
+					keys[n] = first;
+					cur[n] = this->getRoot();
+					res[n] = this->_header;
+                }
+				active = (this->getRoot() != NULL) ? n : 0;
+				while (active > 0)
+                {
+					for (i = 0; i < n; ++i)
+                    {
+						if (cur[i] == NULL)
+                        {
+							continue ;
+                        }
+						if (!this->_comp(cur[i]->pair._first, *keys[i]))
+                        {
+							res[i] = cur[i];
+							cur[i] = cur[i]->lChild;
+                        }
+						else
+                        {
+							cur[i] = cur[i]->rChild;
+                        }
+						if (cur[i] == NULL)
+                        {
+							active--;
+                        }
+						else
+                        {
+							prefetch(cur[i]);
+                        }
+                    }
+                }
+				for (i = 0; i < n; ++i, ++out)
+                {
+					if (res[i] != this->_header && this->_comp(*keys[i], res[i]->pair._first))
+                    {
+						res[i] = this->_header;
+                    }
+					*out = Iterator(res[i]);
+                }
+            }
+			return (out);
+		}
+
+		static void prefetch(const void* p)
+        {
+# if defined(__GNUC__)
+			__builtin_prefetch(p);
+# else
+			(void)p;
+# endif
+		}
+
+		/*
+		* order statistics, Augment has to keep subtree sizes
+		* selectNode returns the node of index k (in key order) or the header,
+		* rankOf the number of keys less than key
+		*/
+		NodePtr selectNode(std::size_t k) const
+        {
+			NodePtr		cur = this->getRoot();
+			std::size_t	leftSize;
+
+			if (k >= this->getSize())
+            {
+				return (this->_header);
+            }
+			for (;;)
+            {
+				leftSize = Augment::size(cur->lChild);
+				if (k == leftSize)
+                {
+					return (cur);
+                }
+				if (k < leftSize)
+                {
+					cur = cur->lChild;
+                }
+				else
+                {
+					k -= leftSize + 1;
+					cur = cur->rChild;
+                }
+            }
+		}
+
+		std::size_t rankOf(const Key& key) const
+        {
+			NodePtr		cur = this->getRoot();
+			std::size_t	rank = 0;
+
+			while (cur != NULL)
+            {
+				if (this->_comp(cur->pair._first, key))
+                {
+					rank += Augment::size(cur->lChild) + 1;
+					cur = cur->rChild;
+                }
+				else
+                {
+					cur = cur->lChild;
+                }
+            }
+			return (rank);
+		}
+
+		/*
+		* combination, in key order, of the elements in [lo, hi)
+		* below the node where the paths to lo and hi split, the left path
+		* picks up whole right subtrees and the right path whole left ones
+		*/
+		typename Augment::aggregate_type aggregateRange(const Key& lo, const Key& hi) const
+        {
+			typedef typename Augment::aggregate_type	agg_type;
+
+			NodePtr		split = this->getRoot();
+			NodePtr		cur;
+			agg_type	left = Augment::identity();
+			agg_type	right = Augment::identity();
+
+			while (split != NULL)
+            {
+				if (this->_comp(split->pair._first, lo))
+                {
+					split = split->rChild;
+                }
+				else if (!this->_comp(split->pair._first, hi))
+                {
+					split = split->lChild;
+                }
+				else
+                {
+					break ;
+                }
+            }
+			if (split == NULL)
+            {
+				return (Augment::identity());
+            }
+			cur = split->lChild;
+			while (cur != NULL)
+            {
+				if (!this->_comp(cur->pair._first, lo))
+                {
+					left = Augment::combine(Augment::combine(Augment::lift(cur), Augment::value(cur->rChild)), left);
+					cur = cur->lChild;
+                }
+				else
+                {
+					cur = cur->rChild;
+                }
+            }
+			cur = split->rChild;
+			while (cur != NULL)
+            {
+				if (this->_comp(cur->pair._first, hi))
+                {
+					right = Augment::combine(right, Augment::combine(Augment::value(cur->lChild), Augment::lift(cur)));
+					cur = cur->rChild;
+                }
+				else
+                {
+					cur = cur->lChild;
+                }
+            }
+			return (Augment::combine(Augment::combine(left, Augment::lift(split)), right));
+		}
+
+		/*
+		* refreshes the augmentation data from x up to the root, after a
+		* change to x's element the aggregates depend on
+		*/
+		void updatePath(NodePtr x)
+        {
+			if (!Augment::enabled)
+            {
+				return ;
+            }
+			while (x != this->_header)
+            {
+				Augment::update(x);
+				x = x->getParent();
+            }
+		}
+
+		/*
+		* set algebra with x, in O(m log(n / m + 1)) for sizes m <= n:
+		* this tree is split around the keys of x, recursively, and the
+		* pieces are joined back, instead of one descent per key
+		* x is only read, elements of x missing here are copied in, those
+		* found on both sides keep the value they have here
+		*/
+		void uniteWith(const BST& x)
+        {
+			Subtree	t;
+
+			if (this == &x || x.getRoot() == NULL)
+            {
+				return ;
+            }
+			t = this->detachRoot();
+			this->attachRoot(this->uniteSubtrees(t, x.getRoot(), blackHeight(x.getRoot())));
+		}
+
+		void intersectWith(const BST& x)
+        {
+			Subtree	t;
+
+			if (this == &x)
+            {
+				return ;
+            }
+			t = this->detachRoot();
+			this->attachRoot(this->intersectSubtrees(t, x.getRoot()));
+		}
+
+		void subtractWith(const BST& x)
+        {
+			Subtree	t;
+
+			if (this == &x)
+            {
+				this->clearTree();
+				return ;
+            }
+			t = this->detachRoot();
+			this->attachRoot(this->subtractSubtrees(t, x.getRoot()));
+		}
+
+		/*
+		* structural moves between trees, no node is copied nor allocated:
+		* the receiving tree's pool adopts the other's (see node_pool::adopt)
+		* splitInto moves the keys not less than key to x, extractRangeInto
+		* those in [lo, hi), in O(log n), the sizes of both trees are then
+		* read from the augmentation (Augment::count) or counted lazily
+		* joinWith takes every node of x, in O(log n) when all the keys of x
+		* are on the same side of those of this tree, otherwise x's nodes are
+		* relinked in by uniteOwned, those whose key is here already released
+		* x's former content is dropped, its comparator replaced
+		*/
+		void splitInto(const Key& key, BST& x)
+        {
+			Subtree	l;
+			Subtree	r;
+			NodePtr	m;
+
+			if (this == &x)
+            {
+				return ;
+            }
+			x.clearTree();
+			x._comp = this->_comp;
+			x._pool.adopt(this->_pool);
+			this->splitSubtree(this->detachRoot(), key, l, m, r);
+			if (m != NULL)
+            {
+				r = this->joinSubtrees(makeSubtree(NULL, 0), m, r);
+            }
+			this->attachRoot(l);
+			x.attachRoot(r);
+			this->_size = (l.root == NULL) ? 0 : Augment::count(l.root);
+			x._size = (r.root == NULL) ? 0 : Augment::count(r.root);
+		}
+
+		void extractRangeInto(const Key& lo, const Key& hi, BST& x)
+        {
+			Subtree	l;
+			Subtree	mid;
+			Subtree	r;
+			NodePtr	m;
+
+			if (this == &x)
+            {
+				return ;
+            }
+			x.clearTree();
+			x._comp = this->_comp;
+			if (!this->_comp(lo, hi))
+            {
+				return ;
+            }
+			x._pool.adopt(this->_pool);
+			this->splitSubtree(this->detachRoot(), lo, l, m, r);
+			if (m != NULL)
+            {
+				r = this->joinSubtrees(makeSubtree(NULL, 0), m, r);
+            }
+			this->splitSubtree(r, hi, mid, m, r);
+			if (m != NULL)
+            {
+				r = this->joinSubtrees(makeSubtree(NULL, 0), m, r);
+            }
+			this->attachRoot(this->joinSubtrees(l, r));
+			x.attachRoot(mid);
+			this->_size = (this->getRoot() == NULL) ? 0 : Augment::count(this->getRoot());
+			x._size = (mid.root == NULL) ? 0 : Augment::count(mid.root);
+		}
+
+		void joinWith(BST& x)
+        {
+			Subtree		t;
+			std::size_t	size;
+
+			if (this == &x || x.getRoot() == NULL)
+            {
+				return ;
+            }
+			this->_pool.adopt(x._pool);
+			if (this->getRoot() != NULL && !this->_comp(this->getRightmost()->pair._first, x.getLeftmost()->pair._first)
+				&& !this->_comp(x.getRightmost()->pair._first, this->getLeftmost()->pair._first))
+            {
+				t = x.detachRoot();
+				x._size = 0;
+				this->attachRoot(this->uniteOwned(this->detachRoot(), t.root, t.height));
+				return ;
+            }
+			size = (this->_size == _unknownSize || x._size == _unknownSize) ? _unknownSize : this->_size + x._size;
+			if (this->getRoot() != NULL && this->_comp(x.getRightmost()->pair._first, this->getLeftmost()->pair._first))
+            {
+				t = x.detachRoot();
+				t = this->joinSubtrees(t, this->detachRoot());
+            }
+			else
+            {
+				t = this->detachRoot();
+				t = this->joinSubtrees(t, x.detachRoot());
+            }
+			this->attachRoot(t);
+			this->_size = size;
+			x._size = 0;
+		}
+
+	private:		
+		void growSize(std::size_t n)
+        {
+			if (this->_size != _unknownSize)
+            {
+				this->_size += n;
+            }
+		}
+
+		void shrinkSize(std::size_t n)
+        {
+			if (this->_size != _unknownSize)
+            {
+				this->_size -= n;
+            }
+		}
+
+		void cloneTree(const BST& x)
+        {
+			NodePtr	root;
+
+			if (x.getRoot() == NULL)
+            {
+				return ;
+            }
+			root = this->cloneSubtree(x.getRoot(), this->_header);
+			this->_header->setParent(root);
+			this->_header->lChild = minimum(root);
+			this->_header->rChild = maximum(root);
+			this->_size = x._size;
+		}
+
+		NodePtr cloneNode(NodePtr x)
+        {
+			NodePtr	node = _pool.allocate();
+
+			_alloc.construct(node, Node(x->pair));
+			node->setColor(x->getColor());
+			static_cast<typename Augment::node_data&>(*node) = *x;
+			return (node);
+		}
+
+		/*
+		* recursion follows right children only, left spines are copied in a loop
+		*/
+		NodePtr cloneSubtree(NodePtr x, NodePtr parent)
+        {
+			NodePtr	top = this->cloneNode(x);
+			NodePtr	y;
+
+			top->setParent(parent);
+			if (x->rChild != NULL)
+            {
+				top->rChild = this->cloneSubtree(x->rChild, top);
+            }
+			parent = top;
+			x = x->lChild;
+			while (x != NULL)
+            {
+				y = this->cloneNode(x);
+				parent->lChild = y;
+				y->setParent(parent);
+				if (x->rChild != NULL)
+                {
+					y->rChild = this->cloneSubtree(x->rChild, y);
+                }
+				parent = y;
+				x = x->lChild;
+            }
+			return (top);
+		}
+
+		/*
+		* post-order release, each node is destroyed exactly once, recursion
+		* only follows right children so its depth is bounded by the height
+		*/
+		void destroySubtree(NodePtr x, bool recycle)
+        {
+			NodePtr	y;
+
+			while (x != NULL)
+            {
+				this->destroySubtree(x->rChild, recycle);
+				y = x->lChild;
+				_alloc.destroy(x);
+				if (recycle)
+                {
+					_pool.deallocate(x);
+                }
+				x = y;
+            }
+		}
+
+		/*
+		* join / split
+		* a Subtree is a detached red-black tree (its root has no parent)
+		* along with its black height, the number of black nodes on any path
+		* from the root down to a leaf
+		*/
+		struct Subtree
+		{
+			NodePtr		root;
+			std::size_t	height;
+		};
+
+		static Subtree makeSubtree(NodePtr root, std::size_t height)
+        {
+			Subtree	res;
+
+			res.root = root;
+			res.height = height;
+			if (root != NULL)
+            {
+				root->setParent(NULL);
+            }
+			return (res);
+		}
+
+		static std::size_t blackHeight(NodePtr x)
+        {
+			std::size_t	res = 0;
+
+			while (x != NULL)
+            {
+				res += !x->getColor();
+				x = x->lChild;
+            }
+			return (res);
+		}
+
+		/*
+		* the root points back at the header, an empty tree's header at
+		* itself
+		*/
+		void setHeader(NodePtr root, NodePtr leftmost, NodePtr rightmost)
+        {
+			this->_header->setParent(root);
+			if (root == NULL)
+            {
+				this->_header->lChild = this->_header;
+				this->_header->rChild = this->_header;
+				return ;
+            }
+			root->setParent(this->_header);
+			this->_header->lChild = leftmost;
+			this->_header->rChild = rightmost;
+		}
+
+		Subtree detachRoot(void)
+        {
+			Subtree	res = makeSubtree(this->getRoot(), blackHeight(this->getRoot()));
+
+			this->_header->setParent(NULL);
+			this->_header->lChild = this->_header;
+			this->_header->rChild = this->_header;
+			return (res);
+		}
+
+		void attachRoot(Subtree t)
+        {
+			if (t.root == NULL)
+            {
+				return ;
+            }
+			t.root->setColor(false);
+			t.root->setParent(this->_header);
+			this->_header->setParent(t.root);
+			this->_header->lChild = minimum(t.root);
+			this->_header->rChild = maximum(t.root);
+		}
+
+		/*
+		* rotations inside a detached subtree, root follows
+		*/
+		void leftRotateIn(NodePtr x, NodePtr& root)
+        {
+			NodePtr	y = x->rChild;
+
+			x->rChild = y->lChild;
+			if (y->lChild != NULL)
+            {
+				y->lChild->setParent(x);
+            }
+			y->setParent(x->getParent());
+			if (x == root)
+            {
+				root = y;
+            }
+			else if (x->getParent()->lChild == x)
+            {
+				x->getParent()->lChild = y;
+            }
+			else
+            {
+				x->getParent()->rChild = y;
+            }
+			y->lChild = x;
+			x->setParent(y);
+			Augment::update(x);
+			Augment::update(y);
+		}
+
+		void rightRotateIn(NodePtr x, NodePtr& root)
+        {
+			NodePtr	y = x->lChild;
+
+			x->lChild = y->rChild;
+			if (y->rChild != NULL)
+            {
+				y->rChild->setParent(x);
+            }
+			y->setParent(x->getParent());
+			if (x == root)
+            {
+				root = y;
+            }
+			else if (x->getParent()->lChild == x)
+            {
+				x->getParent()->lChild = y;
+            }
+			else
+            {
+				x->getParent()->rChild = y;
+            }
+			y->rChild = x;
+			x->setParent(y);
+			Augment::update(x);
+			Augment::update(y);
+		}
+
+		/*
+		* insertFix for a detached subtree: the red x may have a red parent,
+		* the root is left red if the recolouring reaches it
+		*/
+		void joinFix(NodePtr x, NodePtr& root)
+        {
+			NodePtr	p;
+			NodePtr	g;
+			NodePtr	u;
+
+			while (x != root && x->getParent()->getColor())
+            {
+				p = x->getParent();
+				g = p->getParent();
+				u = (p == g->lChild) ? g->rChild : g->lChild;
+				if (u != NULL && u->getColor())
+                {
+					p->setColor(false);
+					u->setColor(false);
+					g->setColor(true);
+					x = g;
+					continue ;
+                }
+				if (p == g->lChild)
+                {
+					if (x == p->rChild)
+                    {
+						this->leftRotateIn(p, root);
+						p = x;
+                    }
+					p->setColor(false);
+					g->setColor(true);
+					this->rightRotateIn(g, root);
+                }
+				else
+                {
+					if (x == p->lChild)
+                    {
+						this->rightRotateIn(p, root);
+						p = x;
+                    }
+					p->setColor(false);
+					g->setColor(true);
+					this->leftRotateIn(g, root);
+                }
+				break ;
+            }
+		}
+
+		/*
+		* l < k < r, in O(|l.height - r.height| + 1): k is hung, red, from the
+		* spine of the higher tree at the first black node as high as the
+		* lower tree, and the red-red conflict is fixed as after an insertion
+		* only the nodes above k need their augmentation data refreshed
+		*/
+		Subtree joinSubtrees(Subtree l, NodePtr k, Subtree r)
+        {
+			NodePtr		c;
+			NodePtr		p = NULL;
+			NodePtr		root;
+			std::size_t	h;
+
+			if (l.root != NULL && l.root->getColor())
+            {
+				l.root->setColor(false);
+				l.height++;
+            }
+			if (r.root != NULL && r.root->getColor())
+            {
+				r.root->setColor(false);
+				r.height++;
+            }
+			k->setColor(true);
+			if (l.height == r.height)
+            {
+				k->lChild = l.root;
+				k->rChild = r.root;
+				k->setParent(NULL);
+				k->setColor(false);
+				if (l.root != NULL)
+                {
+					l.root->setParent(k);
+                }
+				if (r.root != NULL)
+                {
+					r.root->setParent(k);
+                }
+				Augment::update(k);
+				return (makeSubtree(k, l.height + 1));
+            }
+			root = (l.height > r.height) ? l.root : r.root;
+			c = root;
+			h = (l.height > r.height) ? l.height : r.height;
+			while (c != NULL && (c->getColor() || h != ((l.height > r.height) ? r.height : l.height)))
+            {
+				h -= !c->getColor();
+				p = c;
+				c = (l.height > r.height) ? c->rChild : c->lChild;
+            }
+			if (l.height > r.height)
+            {
+				k->lChild = c;
+				k->rChild = r.root;
+				p->rChild = k;
+            }
+			else
+            {
+				k->lChild = l.root;
+				k->rChild = c;
+				p->lChild = k;
+            }
+			k->setParent(p);
+			if (k->lChild != NULL)
+            {
+				k->lChild->setParent(k);
+            }
+			if (k->rChild != NULL)
+            {
+				k->rChild->setParent(k);
+            }
+			Augment::update(k);
+			this->joinFix(k, root);
+			if (Augment::enabled)
+            {
+				for (c = k->getParent(); c != NULL; c = c->getParent())
+                {
+					Augment::update(c);
+                }
+            }
+			h = (l.height > r.height) ? l.height : r.height;
+			if (root->getColor())
+            {
+				root->setColor(false);
+				h++;
+            }
+			return (makeSubtree(root, h));
+		}
+
+		/*
+		* l < r, the largest element of l is split off to join them
+		*/
+		Subtree joinSubtrees(Subtree l, Subtree r)
+        {
+			Subtree	rest;
+			Subtree	empty;
+			NodePtr	k;
+
+			if (l.root == NULL)
+            {
+				return (r);
+            }
+			if (r.root == NULL)
+            {
+				return (l);
+            }
+			this->splitSubtree(l, maximum(l.root)->pair._first, rest, k, empty);
+			return (this->joinSubtrees(rest, k, r));
+		}
+
+		/*
+		* splits t into the keys less than key, the node holding key (or
+		* NULL) and the keys greater, in O(log n): each node on the search
+		* path is joined back with the subtree it keeps on the other side
+		*/
+		void splitSubtree(Subtree t, const Key& key, Subtree& l, NodePtr& m, Subtree& r)
+        {
+			NodePtr		x = t.root;
+			std::size_t	h;
+			Subtree		part;
+
+			if (x == NULL)
+            {
+				l = makeSubtree(NULL, 0);
+				r = l;
+				m = NULL;
+				return ;
+            }
+			h = t.height - !x->getColor();
+			if (this->_comp(key, x->pair._first))
+            {
+				this->splitSubtree(makeSubtree(x->lChild, h), key, l, m, part);
+				r = this->joinSubtrees(part, x, makeSubtree(x->rChild, h));
+            }
+			else if (this->_comp(x->pair._first, key))
+            {
+				this->splitSubtree(makeSubtree(x->rChild, h), key, part, m, r);
+				l = this->joinSubtrees(makeSubtree(x->lChild, h), x, part);
+            }
+			else
+            {
+				l = makeSubtree(x->lChild, h);
+				r = makeSubtree(x->rChild, h);
+				m = x;
+				x->lChild = NULL;
+				x->rChild = NULL;
+            }
+		}
+
+		static std::size_t countNodes(NodePtr x)
+        {
+			std::size_t	res = 0;
+
+			while (x != NULL)
+            {
+				res += 1 + countNodes(x->rChild);
+				x = x->lChild;
+            }
+			return (res);
+		}
+
+		/*
+		* plain insertion into a detached subtree, key absent or not
+		*/
+		void insertIntoSubtree(Subtree& t, const ft::pair<Key, T>& newPair)
+        {
+			NodePtr	cur = t.root;
+			NodePtr	parent = NULL;
+			NodePtr	notGreater = NULL;
+			NodePtr	node;
+			bool	left = true;
+
+			if (cur != NULL && cur->getColor())
+            {
+				cur->setColor(false);
+				t.height++;
+            }
+			while (cur != NULL)
+            {
+				parent = cur;
+				left = this->_comp(newPair._first, cur->pair._first);
+				if (left)
+                {
+					cur = cur->lChild;
+                }
+				else
+                {
+					notGreater = cur;
+					cur = cur->rChild;
+                }
+            }
+			if (notGreater != NULL && !this->_comp(notGreater->pair._first, newPair._first))
+            {
+				return ;
+            }
+			node = _pool.allocate();
+			_alloc.construct(node, Node(newPair));
+			node->setParent(parent);
+			this->growSize(1);
+			if (parent == NULL)
+            {
+				node->setColor(false);
+				t = makeSubtree(node, 1);
+				Augment::update(node);
+				return ;
+            }
+			if (left)
+            {
+				parent->lChild = node;
+            }
+			else
+            {
+				parent->rChild = node;
+            }
+			Augment::update(node);
+			this->joinFix(node, t.root);
+			if (Augment::enabled)
+            {
+				for (cur = node->getParent(); cur != NULL; cur = cur->getParent())
+                {
+					Augment::update(cur);
+                }
+            }
+			if (t.root->getColor())
+            {
+				t.root->setColor(false);
+				t.height++;
+            }
+		}
+
+		/*
+		* in key order, recursion depth bounded by y's height
+		*/
+		void insertSubtree(Subtree& t, NodePtr y)
+        {
+			while (y != NULL)
+            {
+				this->insertSubtree(t, y->lChild);
+				this->insertIntoSubtree(t, y->pair);
+				y = y->rChild;
+            }
+		}
+
+		/*
+		* t is owned, y (of black height yh) belongs to the other tree
+		* when y is much smaller (|t| at least about |y|^2) its elements are
+		* inserted one by one, O(|y| log |t|) is then within the same bound
+		* and cheaper than splitting t again for each of them
+		*/
+		Subtree uniteSubtrees(Subtree t, NodePtr y, std::size_t yh)
+        {
+			Subtree		l;
+			Subtree		r;
+			NodePtr		m;
+			std::size_t	h;
+
+			if (y == NULL)
+            {
+				return (t);
+            }
+			if (t.root == NULL)
+            {
+				if (this->_size != _unknownSize)
+                {
+					this->_size += countNodes(y);
+                }
+				return (makeSubtree(this->cloneSubtree(y, NULL), yh));
+            }
+			if (t.height >= 2 * yh)
+            {
+				this->insertSubtree(t, y);
+				return (t);
+            }
+			h = yh - !y->getColor();
+			this->splitSubtree(t, y->pair._first, l, m, r);
+			l = this->uniteSubtrees(l, y->lChild, h);
+			r = this->uniteSubtrees(r, y->rChild, h);
+			if (m == NULL)
+            {
+				m = _pool.allocate();
+				_alloc.construct(m, Node(y->pair));
+				this->growSize(1);
+            }
+			return (this->joinSubtrees(l, m, r));
+		}
+
+		/*
+		* as uniteSubtrees, but y (of black height yh) is owned and detached:
+		* its nodes are used as join keys instead of copies, those whose key
+		* t holds already are released
+		*/
+		Subtree uniteOwned(Subtree t, NodePtr y, std::size_t yh)
+        {
+			Subtree		l;
+			Subtree		r;
+			NodePtr		m;
+			NodePtr		left;
+			NodePtr		right;
+			std::size_t	h;
+
+			if (y == NULL)
+            {
+				return (t);
+            }
+			if (t.root == NULL)
+            {
+				if (this->_size != _unknownSize)
+                {
+					this->_size += countNodes(y);
+                }
+				return (makeSubtree(y, yh));
+            }
+			h = yh - !y->getColor();
+			left = y->lChild;
+			right = y->rChild;
+			this->splitSubtree(t, y->pair._first, l, m, r);
+			l = this->uniteOwned(l, left, h);
+			r = this->uniteOwned(r, right, h);
+			if (m == NULL)
+            {
+				m = y;
+				this->growSize(1);
+            }
+			else
+            {
+				_alloc.destroy(y);
+				_pool.deallocate(y);
+            }
+			return (this->joinSubtrees(l, m, r));
+		}
+
+		Subtree intersectSubtrees(Subtree t, NodePtr y)
+        {
+			Subtree	l;
+			Subtree	r;
+			NodePtr	m;
+
+			if (t.root == NULL)
+            {
+				return (t);
+            }
+			if (y == NULL)
+            {
+				if (this->_size != _unknownSize)
+                {
+					this->_size -= countNodes(t.root);
+                }
+				this->destroySubtree(t.root, true);
+				return (makeSubtree(NULL, 0));
+            }
+			this->splitSubtree(t, y->pair._first, l, m, r);
+			l = this->intersectSubtrees(l, y->lChild);
+			r = this->intersectSubtrees(r, y->rChild);
+			if (m == NULL)
+            {
+				return (this->joinSubtrees(l, r));
+            }
+			return (this->joinSubtrees(l, m, r));
+		}
+
+		Subtree subtractSubtrees(Subtree t, NodePtr y)
+        {
+			Subtree	l;
+			Subtree	r;
+			NodePtr	m;
+
+			if (t.root == NULL || y == NULL)
+            {
+				return (t);
+            }
+			this->splitSubtree(t, y->pair._first, l, m, r);
+			l = this->subtractSubtrees(l, y->lChild);
+			r = this->subtractSubtrees(r, y->rChild);
+			if (m != NULL)
+            {
+				_alloc.destroy(m);
+				_pool.deallocate(m);
+				this->shrinkSize(1);
+            }
+			return (this->joinSubtrees(l, r));
+		}
+
+		template <class ForwardIterator>
+		NodePtr buildSubtree(ForwardIterator& it, ForwardIterator last, std::size_t n, std::size_t depth, std::size_t redDepth)
+        {
+			NodePtr		node;
+			NodePtr		left;
+			std::size_t	leftSize = (n - 1) / 2;
+
+			if (n == 0)
+            {
+				return (NULL);
+            }
+			left = this->buildSubtree(it, last, leftSize, depth + 1, redDepth);
+			node = _pool.allocate();
+			_alloc.construct(node, Node(*it));
+			++it;
+			while (it != last && !this->_comp(node->pair._first, (*it)._first))
+            {
+				++it;
+            }
+			node->setColor(depth == redDepth);
+			node->lChild = left;
+			if (left != NULL)
+            {
+				left->setParent(node);
+            }
+			node->rChild = this->buildSubtree(it, last, n - leftSize - 1, depth + 1, redDepth);
+			if (node->rChild != NULL)
+            {
+				node->rChild->setParent(node);
+            }
+			Augment::update(node);
+			return (node);
+		}
+
+	public:
+		void printTree(NodePtr root, int space) const 
+        {
+			if (root == NULL)
+            {
+				return ;
+            }
+			space += 5;
+			printTree(root->rChild, space);
+			std::cout << std::endl;
+			for (int i = 5; i < space; i++)
+            {
+				std::cout << " ";
+            }
+
+			std::string		strCol;
+
+			if (root->getColor())
+            {
+				strCol = "\033[1;31m";
+            }
+			else
+            {
+				strCol = "\033[0m";
+            }
+			std::cout << strCol << root->pair._second << "\033[0m" << std::endl;
+		    printTree(root->lChild, space);
+		}
+    };
+
+	/*
+	* node of the persistent tree: no parent link, and a count of the links
+	* (and trees) pointing at it, so a subtree can be shared by any number
+	* of versions
+	* counts are atomic from c++11 on, versions can then be read, copied
+	* and dropped from other threads while one of them keeps being written
+	*/
+	template <class Key, class T>
+	struct PersistentNode
+	{
+		ft::pair<Key, T>	pair;
+		PersistentNode*		lChild;
+		PersistentNode*		rChild;
+		bool				color;
+# if __cplusplus >= 201103L
+		std::atomic<std::size_t>	refs;
+# else
+		std::size_t					refs;
+# endif
+
+		PersistentNode(const ft::pair<Key, T>& newPair): pair(newPair), lChild(NULL), rChild(NULL), color(true), refs(1) {}
+
+		/*
+		* copying makes a clone owned once, sharing x's children
+		*/
+		PersistentNode(const PersistentNode& x): pair(x.pair), lChild(x.lChild), rChild(x.rChild), color(x.color), refs(1) {}
+
+		void	retain(void)
+		{
+# if __cplusplus >= 201103L
+			this->refs.fetch_add(1, std::memory_order_relaxed);
+# else
+			this->refs++;
+# endif
+		}
+
+		/*
+		* true when the last reference is gone
+		*/
+		bool	release(void)
+		{
+# if __cplusplus >= 201103L
+			return (this->refs.fetch_sub(1, std::memory_order_acq_rel) == 1);
+# else
+			return (--this->refs == 0);
+# endif
+		}
+
+		bool	shared(void) const
+		{
+# if __cplusplus >= 201103L
+			return (this->refs.load(std::memory_order_acquire) != 1);
+# else
+			return (this->refs != 1);
+# endif
+		}
+
+	private:		
+		PersistentNode& operator=(const PersistentNode& x);
+	};
+
+	/*
+	* persistent red-black tree
+	* copying a tree only shares its root, updates copy on write: every
+	* shared node met on the way down is cloned before being touched, so an
+	* update copies at most the O(log n) nodes of its path (and siblings
+	* recoloured by the fixup), and a tree nobody shares is updated in place
+	* nodes a version can reach are never modified while it is alive
+	* the fixups work on the path kept during the descent, a red-black tree
+	* is never more than 2 log2(n + 1) high
+	*/
+	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::PersistentNode<Key, T> > >
+	class PersistentBST
+	{
+	public:
+		typedef PersistentNode<Key, T>	Node;
+		typedef Node*					NodePtr;
+		typedef Alloc					allocator_type;
+		typedef Compare					comp_operation;
+
+		static const int	maxHeight = 2 * CHAR_BIT * sizeof(std::size_t);
+
+		/*
+		* read only, the iterator holds its node and the root of the version
+		* it walks, end() is the NULL node
+		* a step goes down the right (left) subtree when there is one, and
+		* otherwise finds the next node by key from the root: O(log n) at
+		* worst, and the iterator stays three words long
+		* it stays valid as long as the version it walks does, updates made
+		* to other versions never affect it
+		*/
+		class Iterator
+		{
+		public:
+			typedef const ft::pair<Key, T>				value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef const ft::pair<Key, T>*				pointer;
+			typedef const ft::pair<Key, T>&				reference;
+			typedef ft::bidirectional_iterator_tag		iterator_category;
+
+		private:
+			friend class PersistentBST;
+			NodePtr	_root;
+			NodePtr	_node;
+			Compare	_comp;
+
+		public:
+			Iterator(void): _root(NULL), _node(NULL), _comp() {}
+
+			Iterator(NodePtr root, NodePtr node, const Compare& comp): _root(root), _node(node), _comp(comp) {}
+
+			NodePtr	getNode(void) const
+			{
+				return (this->_node);
+			}
+
+			reference	operator * (void) const
+            {
+				return (this->_node->pair);
+			}
+
+			pointer	operator -> (void) const
+            {
+				return (&this->_node->pair);
+			}
+
+			Iterator& operator++(void)
+            {
+				NodePtr	cur = this->_root;
+				NodePtr	next = NULL;
+
+				if (this->_node->rChild != NULL)
+                {
+					this->_node = PersistentBST::minimum(this->_node->rChild);
+					return (*this);
+                }
+				while (cur != this->_node)
+                {
+					if (this->_comp(this->_node->pair._first, cur->pair._first))
+                    {
+						next = cur;
+						cur = cur->lChild;
+                    }
+					else
+                    {
+						cur = cur->rChild;
+                    }
+                }
+				this->_node = next;
+				return (*this);
+			}
+
+			Iterator operator++(int)
+            {
+				Iterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			/*
+			* from end(), goes to the last element
+			*/
+			Iterator& operator--(void)
+            {
+				NodePtr	cur = this->_root;
+				NodePtr	prev = NULL;
+
+				if (this->_node == NULL)
+                {
+					this->_node = PersistentBST::maximum(this->_root);
+					return (*this);
+                }
+				if (this->_node->lChild != NULL)
+                {
+					this->_node = PersistentBST::maximum(this->_node->lChild);
+					return (*this);
+                }
+				while (cur != this->_node)
+                {
+					if (this->_comp(cur->pair._first, this->_node->pair._first))
+                    {
+						prev = cur;
+						cur = cur->rChild;
+                    }
+					else
+                    {
+						cur = cur->lChild;
+                    }
+                }
+				this->_node = prev;
+				return (*this);
+			}
+
+			Iterator operator--(int)
+            {
+				Iterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			bool operator==(const Iterator& rhs) const
+			{
+				return (this->_node == rhs._node);
+			}
+
+			bool operator!=(const Iterator& rhs) const
+			{
+				return (this->_node != rhs._node);
+			}
+		};
+
+		typedef Iterator								const_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+	private:		
+		NodePtr		_root;
+		Compare		_comp;
+		Alloc		_alloc;
+		std::size_t	_size;
+
+	public:
+		PersistentBST(const comp_operation& comp = comp_operation(), const allocator_type& alloc = allocator_type()):
+			_root(NULL),
+			_comp(comp),
+			_alloc(alloc),
+			_size(0) {}
+
+		/*
+		* O(1), both trees share every node until one of them is updated
+		*/
+		PersistentBST(const PersistentBST& x): _root(x._root), _comp(x._comp), _alloc(x._alloc), _size(x._size)
+        {
+			if (this->_root != NULL)
+            {
+				this->_root->retain();
+            }
+		}
+
+		PersistentBST& operator=(const PersistentBST& x)
+        {
+			if (x._root != NULL)
+            {
+				x._root->retain();
+            }
+			this->releaseSubtree(this->_root);
+			this->_root = x._root;
+			this->_size = x._size;
+			this->_comp = x._comp;
+			return (*this);
+		}
+
+		~PersistentBST(void)
+        {
+			this->releaseSubtree(this->_root);
+		}
+
+		void swap(PersistentBST& x)
+        {
+			std::swap(this->_root, x._root);
+			std::swap(this->_size, x._size);
+			std::swap(this->_comp, x._comp);
+			std::swap(this->_alloc, x._alloc);
+		}
+
+		void clearTree(void) 
+        {
+			this->releaseSubtree(this->_root);
+			this->_root = NULL;
+			this->_size = 0;
+		}
+
+		std::size_t getSize(void) const 
+        {
+			return (this->_size);
+		}
+
+		NodePtr getRoot(void) const
+        {
+			return (this->_root);
+		}
+
+		const_iterator begin(void) const
+        {
+			return (this->position(minimum(this->_root)));
+		}
+
+		const_iterator end(void) const
+        {
+			return (this->position(NULL));
+		}
+
+		/*
+		* the iterator on node, a node of this version or NULL for end()
+		*/
+		const_iterator position(NodePtr node) const
+        {
+			return (const_iterator(this->_root, node, this->_comp));
+		}
+
+		NodePtr searchNode(const Key& key) const
+        {
+			NodePtr	cur = this->_root;
+
+			while (cur != NULL)
+            {
+				if (this->_comp(key, cur->pair._first))
+                {
+					cur = cur->lChild;
+                }
+				else if (this->_comp(cur->pair._first, key))
+                {
+					cur = cur->rChild;
+                }
+				else
+                {
+					return (cur);
+                }
+            }
+			return (NULL);
+		}
+
+		const_iterator lowerBound(const Key& key) const
+        {
+			NodePtr	cur = this->_root;
+			NodePtr	res = NULL;
+
+			while (cur != NULL)
+            {
+				if (!this->_comp(cur->pair._first, key))
+                {
+					res = cur;
+					cur = cur->lChild;
+                }
+				else
+                {
+					cur = cur->rChild;
+                }
+            }
+			return (this->position(res));
+		}
+
+		const_iterator upperBound(const Key& key) const
+        {
+			NodePtr	cur = this->_root;
+			NodePtr	res = NULL;
+
+			while (cur != NULL)
+            {
+				if (this->_comp(key, cur->pair._first))
+                {
+					res = cur;
+					cur = cur->lChild;
+                }
+				else
+                {
+					cur = cur->rChild;
+                }
+            }
+			return (this->position(res));
+		}
+
+		const_iterator find(const Key& key) const
+        {
+			return (this->position(this->searchNode(key)));
+		}
+
+		/*
+		* the node holding key, owned by this tree alone (its path is copied
+		* if it was shared) so it can be modified, NULL if key is absent
+		* it stays private until the tree is next copied
+		*/
+		NodePtr ownNode(const Key& key)
+        {
+			NodePtr	path[maxHeight];
+			bool	found;
+			int		d = this->searchPath(key, path, found);
+
+			if (!found)
+            {
+				return (NULL);
+            }
+			this->ownPath(path, d);
+			return (path[d - 1]);
+		}
+
+		/*
+		* a key already there is left alone and returned, nothing is copied
+		*/
+		ft::pair<NodePtr, bool> insertNode(const ft::pair<Key, T>& newPair) 
+        {
+			NodePtr		path[maxHeight];
+			NodePtr*	link = &this->_root;
+			bool		found;
+			int			d = this->searchPath(newPair._first, path, found);
+
+			if (found)
+            {
+				return (ft::make_pair(path[d - 1], false));
+            }
+			this->ownPath(path, d);
+			if (d > 0)
+            {
+				link = this->_comp(newPair._first, path[d - 1]->pair._first) ? &path[d - 1]->lChild : &path[d - 1]->rChild;
+            }
+			*link = this->_alloc.allocate(1);
+			this->_alloc.construct(*link, Node(newPair));
+			path[d] = *link;
+			this->_size++;
+			this->insertFix(path, d);
+			return (ft::make_pair(path[d], true));
+		}
+
+		/*
+		* a node with two children takes the payload of its successor, which
+		* is unlinked instead
+		*/
+		bool deleteNode(const Key& key) 
+        {
+			NodePtr		path[maxHeight];
+			NodePtr*	link = &this->_root;
+			NodePtr		z;
+			NodePtr		y;
+			NodePtr		x;
+			bool		found;
+			int			d = this->searchPath(key, path, found) - 1;
+			bool		color;
+
+			if (!found)
+            {
+				return (false);
+            }
+			this->ownPath(path, d + 1);
+			z = path[d];
+			if (d > 0)
+            {
+				link = (path[d - 1]->lChild == z) ? &path[d - 1]->lChild : &path[d - 1]->rChild;
+            }
+			y = z;
+			if (z->lChild != NULL && z->rChild != NULL)
+            {
+				path[d++] = z;
+				link = &z->rChild;
+				y = this->own(*link);
+				while (y->lChild != NULL)
+                {
+					path[d++] = y;
+					link = &y->lChild;
+					y = this->own(*link);
+                }
+				z->pair = y->pair;
+            }
+			x = (y->lChild != NULL) ? y->lChild : y->rChild;
+			*link = x;
+			color = y->color;
+			this->_alloc.destroy(y);
+			this->_alloc.deallocate(y, 1);
+			this->_size--;
+			if (!color)
+            {
+				this->deleteFix(path, d, x);
+            }
+			return (true);
+		}
+
+	private:		
+		static bool isBlack(NodePtr x)
+        {
+			return (x == NULL || !x->color);
+		}
+
+		static NodePtr minimum(NodePtr x)
+        {
+			while (x != NULL && x->lChild != NULL)
+            {
+				x = x->lChild;
+            }
+			return (x);
+		}
+
+		static NodePtr maximum(NodePtr x)
+        {
+			while (x != NULL && x->rChild != NULL)
+            {
+				x = x->rChild;
+            }
+			return (x);
+		}
+
+		/*
+		* records the nodes from the root down to key, or down to the one
+		* it would go under, in path and returns how many; found tells
+		* whether the last one holds key
+		* nothing is copied, updates then go through ownPath
+		*/
+		int searchPath(const Key& key, NodePtr* path, bool& found) const
+        {
+			NodePtr	cur = this->_root;
+			int		d = 0;
+
+			found = false;
+			while (cur != NULL)
+            {
+				path[d++] = cur;
+				if (this->_comp(key, cur->pair._first))
+                {
+					cur = cur->lChild;
+                }
+				else if (this->_comp(cur->pair._first, key))
+                {
+					cur = cur->rChild;
+                }
+				else
+                {
+					found = true;
+					break ;
+                }
+            }
+			return (d);
+		}
+
+		/*
+		* makes path[0 .. n - 1], recorded from the root down, private to
+		* this tree, top down; a clone shares its children, so the next node
+		* of the path is told apart by its address, no key is compared
+		*/
+		void ownPath(NodePtr* path, int n)
+        {
+			NodePtr*	link = &this->_root;
+
+			for (int i = 0; i < n; i++)
+            {
+				path[i] = this->own(*link);
+				if (i + 1 < n)
+                {
+					link = (path[i]->lChild == path[i + 1]) ? &path[i]->lChild : &path[i]->rChild;
+                }
+            }
+		}
+
+		/*
+		* makes the node behind link private to this tree, cloning it when
+		* it is shared: the clone takes one more reference on each child
+		*/
+		NodePtr own(NodePtr& link)
+        {
+			NodePtr	copy;
+
+			if (!link->shared())
+            {
+				return (link);
+            }
+			copy = this->_alloc.allocate(1);
+			this->_alloc.construct(copy, *link);
+			if (copy->lChild != NULL)
+            {
+				copy->lChild->retain();
+            }
+			if (copy->rChild != NULL)
+            {
+				copy->rChild->retain();
+            }
+			this->releaseSubtree(link);
+			link = copy;
+			return (copy);
+		}
+
+		/*
+		* drops one reference, freeing the nodes nobody points at anymore
+		*/
+		void releaseSubtree(NodePtr x)
+        {
+			NodePtr	y;
+
+			while (x != NULL && x->release())
+            {
+				this->releaseSubtree(x->rChild);
+				y = x->lChild;
+				this->_alloc.destroy(x);
+				this->_alloc.deallocate(x, 1);
+				x = y;
+            }
+		}
+
+		void replaceChild(NodePtr parent, NodePtr oldChild, NodePtr newChild)
+        {
+			if (parent == NULL)
+            {
+				this->_root = newChild;
+            }
+			else if (parent->lChild == oldChild)
+            {
+				parent->lChild = newChild;
+            }
+			else
+            {
+				parent->rChild = newChild;
+            }
+		}
+
+		/*
+		* x and the child moving up have to be owned, subtrees only change
+		* parent
+		*/
+		void leftRotate(NodePtr x, NodePtr parent)
+        {
+			NodePtr	y = x->rChild;
+
+			x->rChild = y->lChild;
+			y->lChild = x;
+			this->replaceChild(parent, x, y);
+		}
+
+		void rightRotate(NodePtr x, NodePtr parent)
+        {
+			NodePtr	y = x->lChild;
+
+			x->lChild = y->rChild;
+			y->rChild = x;
+			this->replaceChild(parent, x, y);
+		}
+
+		/*
+		* path[0 .. d] goes from the root to the new node, all owned
+		*/
+		void insertFix(NodePtr* path, int d)
+        {
+			NodePtr	p;
+			NodePtr	g;
+
+			while (d >= 2 && path[d - 1]->color)
+            {
+				p = path[d - 1];
+				g = path[d - 2];
+				if (p == g->lChild)
+                {
+					if (!isBlack(g->rChild))
+                    {
+						this->own(g->rChild)->color = false;
+						p->color = false;
+						g->color = true;
+						d -= 2;
+						continue ;
+                    }
+					if (path[d] == p->rChild)
+                    {
+						this->leftRotate(p, g);
+						p = path[d];
+                    }
+					p->color = false;
+					g->color = true;
+					this->rightRotate(g, d >= 3 ? path[d - 3] : NULL);
+					break ;
+                }
+				if (!isBlack(g->lChild))
+                {
+					this->own(g->lChild)->color = false;
+					p->color = false;
+					g->color = true;
+					d -= 2;
+					continue ;
+                }
+				if (path[d] == p->lChild)
+                {
+					this->rightRotate(p, g);
+					p = path[d];
+                }
+				p->color = false;
+				g->color = true;
+				this->leftRotate(g, d >= 3 ? path[d - 3] : NULL);
+				break ;
+            }
+			this->_root->color = false;
+		}
+
+		/*
+		* x took the place of a black node under path[d - 1] (path[0 .. d - 1]
+		* all owned), the sibling and the nephews are owned before being
+		* recoloured or rotated
+		* a rotation at the parent puts the sibling above it on the path
+		*/
+		void deleteFix(NodePtr* path, int d, NodePtr x)
+        {
+			NodePtr	xParent;
+			NodePtr	w;
+
+			while (d > 0 && isBlack(x))
+            {
+				xParent = path[d - 1];
+				if (x == xParent->lChild)
+                {
+					w = this->own(xParent->rChild);
+					if (w->color)
+                    {
+						w->color = false;
+						xParent->color = true;
+						this->leftRotate(xParent, d >= 2 ? path[d - 2] : NULL);
+						path[d - 1] = w;
+						path[d++] = xParent;
+						w = this->own(xParent->rChild);
+                    }
+					if (isBlack(w->lChild) && isBlack(w->rChild))
+                    {
+						w->color = true;
+						x = xParent;
+						d--;
+						continue ;
+                    }
+					if (isBlack(w->rChild))
+                    {
+						this->own(w->lChild)->color = false;
+						w->color = true;
+						this->rightRotate(w, xParent);
+						w = xParent->rChild;
+                    }
+					w->color = xParent->color;
+					xParent->color = false;
+					this->own(w->rChild)->color = false;
+					this->leftRotate(xParent, d >= 2 ? path[d - 2] : NULL);
+                }
+				else
+                {
+					w = this->own(xParent->lChild);
+					if (w->color)
+                    {
+						w->color = false;
+						xParent->color = true;
+						this->rightRotate(xParent, d >= 2 ? path[d - 2] : NULL);
+						path[d - 1] = w;
+						path[d++] = xParent;
+						w = this->own(xParent->lChild);
+                    }
+					if (isBlack(w->lChild) && isBlack(w->rChild))
+                    {
+						w->color = true;
+						x = xParent;
+						d--;
+						continue ;
+                    }
+					if (isBlack(w->lChild))
+                    {
+						this->own(w->rChild)->color = false;
+						w->color = true;
+						this->leftRotate(w, xParent);
+						w = xParent->lChild;
+                    }
+					w->color = xParent->color;
+					xParent->color = false;
+					this->own(w->lChild)->color = false;
+					this->rightRotate(xParent, d >= 2 ? path[d - 2] : NULL);
+                }
+				x = this->_root;
+				d = 0;
+            }
+			if (x == NULL || !x->color)
+            {
+				return ;
+            }
+			if (d == 0)
+            {
+				this->own(this->_root)->color = false;
+            }
+			else if (path[d - 1]->lChild == x)
+            {
+				this->own(path[d - 1]->lChild)->color = false;
+            }
+			else
+            {
+				this->own(path[d - 1]->rChild)->color = false;
+            }
+		}
+	};
+}
+
 #endif
\ No newline at end of file
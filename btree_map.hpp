@@ -0,0 +1,1406 @@
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include <functional>
+# include <stdexcept>
+# include <iterator>
+# include <algorithm>
+# include <memory>
+# include "pair.hpp"
+# include "iterator.hpp"
+# include "iterator_traits.hpp"
+# include "reverse_iterator.hpp"
+# include "enable_if.hpp"
+# include "is_integral.hpp"
+# include "equal.hpp"
+# include "lexicographical_compare.hpp"
+
+/*
+* B+tree ordered map with the interface of ft::map
+* nodes have a fixed fanout computed so that a node fits in NodeSize bytes
+* (a few cache lines by default, a page can be asked for), values only live
+* in the leaves which are chained together for range scans, inner nodes
+* only hold separator keys and children
+* separator i of an inner node is greater than every key below child i and
+* not greater than any key below child i + 1
+* unlike ft::map, insertions and erasures invalidate iterators
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >, std::size_t NodeSize = 256>
+    class btree_map
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+		typedef Compare					key_compare;
+		typedef Alloc					allocator_type;
+
+		typedef value_type&						reference;
+		typedef const value_type&				const_reference;
+		typedef typename Alloc::pointer			pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+
+        class value_compare
+        {
+			friend class btree_map;
+
+        public:
+            typedef bool		result_type;
+			typedef value_type	first_argument_type;
+			typedef value_type	second_argument_type;
+
+			bool operator()(const value_type& x, const value_type& y) const
+            {
+				return (this->_comp(x._first, y._first));
+			}
+
+        protected:
+			Compare		_comp;
+
+			value_compare(Compare c) : _comp(c) {};
+        };
+
+    private:
+		typedef ft::pair<Key, T>	slot_type;
+
+		struct InnerNode;
+
+		struct NodeBase
+		{
+			InnerNode*		parent;
+			unsigned short	position;
+			unsigned short	count;
+			bool			leaf;
+		};
+
+		/*
+		* raw, suitably aligned, storage for N objects constructed on demand
+		*/
+		template <class U, std::size_t N>
+		union RawArray
+		{
+			char		bytes[sizeof(U) * N];
+			void*		alignPtr;
+			long		alignLong;
+			double		alignDouble;
+			long double	alignLongDouble;
+		};
+
+		static const size_type	_leafOverhead = sizeof(NodeBase) + 2 * sizeof(void*);
+		static const size_type	_innerOverhead = sizeof(NodeBase) + sizeof(void*);
+
+	public:
+		static const size_type	leafSlots = (NodeSize > _leafOverhead + 4 * sizeof(slot_type)) ? (NodeSize - _leafOverhead) / sizeof(slot_type) : 4;
+		static const size_type	innerSlots = (NodeSize > _innerOverhead + 4 * (sizeof(Key) + sizeof(void*))) ? (NodeSize - _innerOverhead) / (sizeof(Key) + sizeof(void*)) : 4;
+
+	private:
+		static const size_type	_minLeaf = leafSlots / 2;
+		static const size_type	_minInner = innerSlots / 2;
+
+		struct LeafNode: public NodeBase
+		{
+			LeafNode*						prev;
+			LeafNode*						next;
+			RawArray<slot_type, leafSlots>	slots;
+
+			slot_type*	values(void)
+			{
+				return (reinterpret_cast<slot_type*>(this->slots.bytes));
+			}
+		};
+
+		struct InnerNode: public NodeBase
+		{
+			RawArray<Key, innerSlots>	keyStore;
+			NodeBase*					children[innerSlots + 1];
+
+			Key*	keys(void)
+			{
+				return (reinterpret_cast<Key*>(this->keyStore.bytes));
+			}
+		};
+
+		typedef typename Alloc::template rebind<slot_type>::other	slot_allocator_type;
+		typedef typename Alloc::template rebind<Key>::other			key_allocator_type;
+		typedef typename Alloc::template rebind<LeafNode>::other	leaf_allocator_type;
+		typedef typename Alloc::template rebind<InnerNode>::other	inner_allocator_type;
+		typedef typename Alloc::template rebind<NodeBase*>::other	level_allocator_type;
+
+	public:
+		/*
+		* a leaf and a slot in it, end() is one past the last slot of the
+		* last leaf
+		* slots hold ft::pair<Key, T> so leaves can shift them around, they
+		* are handed out as value_type (same layout), whose key is const
+		*/
+		template <class U>
+		class BTreeIterator
+		{
+		public:
+			typedef U									value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef U*									pointer;
+			typedef U&									reference;
+			typedef ft::bidirectional_iterator_tag		iterator_category;
+
+		private:
+			friend class btree_map;
+			LeafNode*	_node;
+			size_type	_position;
+
+		public:
+			BTreeIterator(void): _node(NULL), _position(0) {}
+
+			BTreeIterator(LeafNode* node, size_type position): _node(node), _position(position) {}
+
+			template <class V>
+			BTreeIterator(const BTreeIterator<V>& x): _node(x.getLeaf()), _position(x.getPosition()) {}
+
+			LeafNode*	getLeaf(void) const
+			{
+				return (this->_node);
+			}
+
+			size_type	getPosition(void) const
+			{
+				return (this->_position);
+			}
+
+			reference	operator * (void) const
+			{
+				return (*this->operator->());
+			}
+
+			pointer	operator -> (void) const
+			{
+				return (reinterpret_cast<pointer>(this->_node->values() + this->_position));
+			}
+
+			BTreeIterator& operator++(void)
+			{
+				this->_position++;
+				if (this->_position == this->_node->count && this->_node->next != NULL)
+				{
+					this->_node = this->_node->next;
+					this->_position = 0;
+				}
+				return (*this);
+			}
+
+			BTreeIterator operator++(int)
+			{
+				BTreeIterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			BTreeIterator& operator--(void)
+			{
+				if (this->_position == 0)
+				{
+					this->_node = this->_node->prev;
+					this->_position = this->_node->count;
+				}
+				this->_position--;
+				return (*this);
+			}
+
+			BTreeIterator operator--(int)
+			{
+				BTreeIterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			template <class V>
+			bool operator==(const BTreeIterator<V>& rhs) const
+			{
+				return (this->_node == rhs.getLeaf() && this->_position == rhs.getPosition());
+			}
+
+			template <class V>
+			bool operator!=(const BTreeIterator<V>& rhs) const
+			{
+				return (!(*this == rhs));
+			}
+		};
+
+		typedef BTreeIterator<value_type>				iterator;
+		typedef BTreeIterator<const value_type>			const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+    private:
+        allocator_type          _alloc;
+        key_compare             _compare;
+		slot_allocator_type		_slotAlloc;
+		key_allocator_type		_keyAlloc;
+		leaf_allocator_type		_leafAlloc;
+		inner_allocator_type	_innerAlloc;
+		NodeBase*				_root;
+		LeafNode*				_first;
+		LeafNode*				_last;
+		size_type				_size;
+
+    public:
+        explicit btree_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _compare(comp),
+			_slotAlloc(alloc),
+			_keyAlloc(alloc),
+			_leafAlloc(alloc),
+			_innerAlloc(alloc),
+			_root(NULL),
+			_first(NULL),
+			_last(NULL),
+			_size(0) {}
+
+        template <class InputIterator>
+		btree_map(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last,
+			const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _compare(comp),
+			_slotAlloc(alloc),
+			_keyAlloc(alloc),
+			_leafAlloc(alloc),
+			_innerAlloc(alloc),
+			_root(NULL),
+			_first(NULL),
+			_last(NULL),
+			_size(0)
+        {
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+        btree_map(const btree_map& x):
+            _alloc(x._alloc),
+            _compare(x._compare),
+			_slotAlloc(x._alloc),
+			_keyAlloc(x._alloc),
+			_leafAlloc(x._alloc),
+			_innerAlloc(x._alloc),
+			_root(NULL),
+			_first(NULL),
+			_last(NULL),
+			_size(0)
+        {
+			this->bulkLoad(x.begin(), x.end(), x.size());
+		}
+
+		btree_map& operator=(const btree_map& x)
+        {
+		    if (this == &x)
+            {
+		    	return (*this);
+            }
+			this->clear();
+			this->_compare = x._compare;
+			this->bulkLoad(x.begin(), x.end(), x.size());
+		    return (*this);
+		}
+
+        ~btree_map(void)
+		{
+			this->clear();
+		}
+
+        iterator begin(void)
+        {
+			return (iterator(this->_first, 0));
+		}
+
+		const_iterator begin(void) const
+        {
+			return (const_iterator(this->_first, 0));
+		}
+
+		iterator end(void)
+        {
+			return (iterator(this->_last, this->_last == NULL ? 0 : this->_last->count));
+		}
+
+		const_iterator end(void) const
+        {
+			return (const_iterator(this->_last, this->_last == NULL ? 0 : this->_last->count));
+		}
+
+		reverse_iterator rbegin(void)
+        {
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator	rbegin(void) const
+        {
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend(void)
+        {
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator	rend(void) const
+        {
+			return (const_reverse_iterator(this->begin()));
+		}
+
+        bool empty(void) const
+        {
+			return (this->_size == 0);
+		}
+
+		size_type size(void) const
+        {
+			return (this->_size);
+		}
+
+		size_type max_size(void) const
+        {
+			return (this->_slotAlloc.max_size());
+		}
+
+        mapped_type& operator[](const key_type& k)
+        {
+			return ((*this->try_emplace(k)._first)._second);
+		}
+
+		mapped_type& at(const key_type& k)
+        {
+			iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+		const mapped_type& at(const key_type& k) const
+        {
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+        ft::pair<iterator, bool> insert(const value_type& val)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (this->findSlot(val._first, leaf, pos))
+            {
+				return (ft::make_pair(iterator(leaf, pos), false));
+            }
+			return (ft::make_pair(this->insertAt(leaf, pos, val), true));
+        }
+
+		/*
+		* when val's key falls within the keys of position's leaf (or past an
+		* end of the first / last leaf) it is placed by a search in that leaf
+		* alone, otherwise this falls back to insert(val)
+		*/
+        iterator insert(iterator position, const value_type& val)
+        {
+			LeafNode*	leaf = position._node;
+			size_type	pos;
+
+			if (leaf == NULL || !this->inLeafRange(leaf, val._first))
+            {
+				return (this->insert(val)._first);
+            }
+			pos = this->leafLowerBound(leaf, val._first);
+			if (pos < leaf->count && !this->_compare(val._first, leaf->values()[pos]._first))
+            {
+				return (iterator(leaf, pos));
+            }
+			return (this->insertAt(leaf, pos, val));
+		}
+
+        template <class InputIterator>
+		void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+        {
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (this->findSlot(k, leaf, pos))
+            {
+				return (ft::make_pair(iterator(leaf, pos), false));
+            }
+			return (ft::make_pair(this->insertAt(leaf, pos, slot_type(k, mapped_type())), true));
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k, const mapped_type& obj)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (this->findSlot(k, leaf, pos))
+            {
+				return (ft::make_pair(iterator(leaf, pos), false));
+            }
+			return (ft::make_pair(this->insertAt(leaf, pos, slot_type(k, obj)), true));
+		}
+
+		ft::pair<iterator, bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (this->findSlot(k, leaf, pos))
+            {
+				leaf->values()[pos]._second = obj;
+				return (ft::make_pair(iterator(leaf, pos), false));
+            }
+			return (ft::make_pair(this->insertAt(leaf, pos, slot_type(k, obj)), true));
+		}
+
+        void erase(iterator position)
+        {
+			this->eraseAt(position._node, position._position);
+		}
+
+        size_type erase(const key_type& k)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (!this->findSlot(k, leaf, pos))
+            {
+				return (0);
+            }
+			this->eraseAt(leaf, pos);
+			return (1);
+		}
+
+		/*
+		* the range is erased leaf by leaf: each leaf drops its whole run at
+		* once, and as rebalancing moves slots around, the next leaf is found
+		* again from the first key, O(k + (k / leafSlots + 1) log n)
+		*/
+        void erase(iterator first, iterator last)
+        {
+			LeafNode*	leaf = first._node;
+			size_type	pos = first._position;
+			size_type	end;
+			bool		toEnd = (last == this->end());
+			bool		more;
+
+			if (first == last)
+            {
+				return ;
+            }
+			if (first == this->begin() && toEnd)
+            {
+				this->clear();
+				return ;
+            }
+
+			key_type	from(first->_first);
+			key_type	stop(toEnd ? first->_first : last->_first);
+
+			for (;;)
+            {
+				end = toEnd ? leaf->count : this->leafLowerBound(leaf, stop);
+				more = (end == leaf->count && leaf->next != NULL
+					&& (toEnd || this->_compare(leaf->next->values()[0]._first, stop)));
+				this->eraseRun(leaf, pos, end - pos);
+				if (!more)
+                {
+					return ;
+                }
+				first = this->lower_bound(from);
+				leaf = first._node;
+				pos = first._position;
+            }
+		}
+
+        void swap(btree_map& x)
+        {
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_compare, x._compare);
+			std::swap(this->_slotAlloc, x._slotAlloc);
+			std::swap(this->_keyAlloc, x._keyAlloc);
+			std::swap(this->_leafAlloc, x._leafAlloc);
+			std::swap(this->_innerAlloc, x._innerAlloc);
+			std::swap(this->_root, x._root);
+			std::swap(this->_first, x._first);
+			std::swap(this->_last, x._last);
+			std::swap(this->_size, x._size);
+		}
+
+        void clear(void)
+        {
+			if (this->_root != NULL)
+            {
+				this->destroyNode(this->_root);
+            }
+			this->_root = NULL;
+			this->_first = NULL;
+			this->_last = NULL;
+			this->_size = 0;
+		}
+
+        key_compare key_comp(void) const
+        {
+			return (this->_compare);
+		}
+
+		value_compare value_comp(void) const
+        {
+			return (value_compare(this->_compare));
+		}
+
+		iterator find(const key_type& k)
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			if (!this->findSlot(k, leaf, pos))
+            {
+				return (this->end());
+            }
+			return (iterator(leaf, pos));
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			return (const_cast<btree_map*>(this)->find(k));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			LeafNode*	leaf;
+			size_type	pos;
+
+			return (this->findSlot(k, leaf, pos) ? 1 : 0);
+		}
+
+		iterator lower_bound(const key_type& k)
+        {
+			LeafNode*	leaf = this->findLeaf(k);
+
+			if (leaf == NULL)
+            {
+				return (this->end());
+            }
+			return (this->normalize(leaf, this->leafLowerBound(leaf, k)));
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+        {
+			return (const_cast<btree_map*>(this)->lower_bound(k));
+		}
+
+		iterator upper_bound(const key_type& k)
+        {
+			LeafNode*	leaf = this->findLeaf(k);
+
+			if (leaf == NULL)
+            {
+				return (this->end());
+            }
+			return (this->normalize(leaf, this->leafUpperBound(leaf, k)));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+        {
+			return (const_cast<btree_map*>(this)->upper_bound(k));
+		}
+
+		ft::pair<iterator, iterator> equal_range(const key_type& k)
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+        allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+    private:
+		/*
+		* searches
+		*/
+		size_type innerChild(InnerNode* node, const key_type& k) const
+		{
+			Key*		keys = node->keys();
+			size_type	lo = 0;
+			size_type	hi = node->count;
+			size_type	mid;
+
+			while (lo < hi)
+			{
+				mid = (lo + hi) / 2;
+				if (this->_compare(k, keys[mid]))
+				{
+					hi = mid;
+				}
+				else
+				{
+					lo = mid + 1;
+				}
+			}
+			return (lo);
+		}
+
+		size_type leafLowerBound(LeafNode* leaf, const key_type& k) const
+		{
+			slot_type*	values = leaf->values();
+			size_type	lo = 0;
+			size_type	hi = leaf->count;
+			size_type	mid;
+
+			while (lo < hi)
+			{
+				mid = (lo + hi) / 2;
+				if (this->_compare(values[mid]._first, k))
+				{
+					lo = mid + 1;
+				}
+				else
+				{
+					hi = mid;
+				}
+			}
+			return (lo);
+		}
+
+		size_type leafUpperBound(LeafNode* leaf, const key_type& k) const
+		{
+			slot_type*	values = leaf->values();
+			size_type	lo = 0;
+			size_type	hi = leaf->count;
+			size_type	mid;
+
+			while (lo < hi)
+			{
+				mid = (lo + hi) / 2;
+				if (this->_compare(k, values[mid]._first))
+				{
+					hi = mid;
+				}
+				else
+				{
+					lo = mid + 1;
+				}
+			}
+			return (lo);
+		}
+
+		LeafNode* findLeaf(const key_type& k) const
+		{
+			NodeBase*	node = this->_root;
+
+			if (node == NULL)
+			{
+				return (NULL);
+			}
+			while (!node->leaf)
+			{
+				InnerNode*	inner = static_cast<InnerNode*>(node);
+
+				node = inner->children[this->innerChild(inner, k)];
+			}
+			return (static_cast<LeafNode*>(node));
+		}
+
+		/*
+		* leaf and slot where k is or would be inserted, false when it is absent
+		*/
+		bool findSlot(const key_type& k, LeafNode*& leaf, size_type& pos) const
+		{
+			leaf = this->findLeaf(k);
+			pos = 0;
+			if (leaf == NULL)
+			{
+				return (false);
+			}
+			pos = this->leafLowerBound(leaf, k);
+			return (pos < leaf->count && !this->_compare(k, leaf->values()[pos]._first));
+		}
+
+		/*
+		* true when k can only belong to leaf: between its smallest and
+		* largest keys, or beyond them on the side where no leaf follows
+		*/
+		bool inLeafRange(LeafNode* leaf, const key_type& k) const
+		{
+			if (leaf->count == 0)
+			{
+				return (false);
+			}
+			if (this->_compare(k, leaf->values()[0]._first))
+			{
+				return (leaf->prev == NULL);
+			}
+			if (this->_compare(leaf->values()[leaf->count - 1]._first, k))
+			{
+				return (leaf->next == NULL);
+			}
+			return (true);
+		}
+
+		iterator normalize(LeafNode* leaf, size_type pos)
+		{
+			if (pos == leaf->count && leaf->next != NULL)
+			{
+				return (iterator(leaf->next, 0));
+			}
+			return (iterator(leaf, pos));
+		}
+
+		/*
+		* slot arrays: objects are constructed in raw storage, shifting keeps
+		* the live prefix [0, count) constructed
+		*/
+		template <class U, class A>
+		static void arrayInsert(A& alloc, U* array, size_type count, size_type pos, const U& val)
+		{
+			if (pos == count)
+			{
+				alloc.construct(array + count, val);
+				return ;
+			}
+			alloc.construct(array + count, array[count - 1]);
+			for (size_type i = count - 1; i > pos; i--)
+			{
+				array[i] = array[i - 1];
+			}
+			array[pos] = val;
+		}
+
+		template <class U, class A>
+		static void arrayErase(A& alloc, U* array, size_type count, size_type pos)
+		{
+			for (size_type i = pos; i + 1 < count; i++)
+			{
+				array[i] = array[i + 1];
+			}
+			alloc.destroy(array + count - 1);
+		}
+
+		template <class U, class A>
+		static void arrayMove(A& alloc, U* dst, U* src, size_type n)
+		{
+			for (size_type i = 0; i < n; i++)
+			{
+				alloc.construct(dst + i, src[i]);
+				alloc.destroy(src + i);
+			}
+		}
+
+		static void setChild(InnerNode* node, size_type i, NodeBase* child)
+		{
+			node->children[i] = child;
+			child->parent = node;
+			child->position = static_cast<unsigned short>(i);
+		}
+
+		/*
+		* node management
+		*/
+		LeafNode* newLeaf(void)
+		{
+			LeafNode*	leaf = this->_leafAlloc.allocate(1);
+
+			leaf->parent = NULL;
+			leaf->position = 0;
+			leaf->count = 0;
+			leaf->leaf = true;
+			leaf->prev = NULL;
+			leaf->next = NULL;
+			return (leaf);
+		}
+
+		InnerNode* newInner(void)
+		{
+			InnerNode*	inner = this->_innerAlloc.allocate(1);
+
+			inner->parent = NULL;
+			inner->position = 0;
+			inner->count = 0;
+			inner->leaf = false;
+			return (inner);
+		}
+
+		void freeLeaf(LeafNode* leaf)
+		{
+			for (size_type i = 0; i < leaf->count; i++)
+			{
+				this->_slotAlloc.destroy(leaf->values() + i);
+			}
+			this->_leafAlloc.deallocate(leaf, 1);
+		}
+
+		void freeInner(InnerNode* inner)
+		{
+			for (size_type i = 0; i < inner->count; i++)
+			{
+				this->_keyAlloc.destroy(inner->keys() + i);
+			}
+			this->_innerAlloc.deallocate(inner, 1);
+		}
+
+		void destroyNode(NodeBase* node)
+		{
+			if (node->leaf)
+			{
+				this->freeLeaf(static_cast<LeafNode*>(node));
+				return ;
+			}
+			InnerNode*	inner = static_cast<InnerNode*>(node);
+
+			for (size_type i = 0; i <= inner->count; i++)
+			{
+				this->destroyNode(inner->children[i]);
+			}
+			this->freeInner(inner);
+		}
+
+		/*
+		* insertion
+		* a full leaf is split in two halves, except for the last leaf when
+		* appending: it is left full and the new leaf starts with the new
+		* value, so increasing keys fill leaves completely
+		*/
+		iterator insertAt(LeafNode* leaf, size_type pos, const slot_type& val)
+		{
+			LeafNode*	right;
+			size_type	mid;
+
+			this->_size++;
+			if (leaf == NULL)
+			{
+				leaf = this->newLeaf();
+				this->_root = leaf;
+				this->_first = leaf;
+				this->_last = leaf;
+			}
+			if (leaf->count < leafSlots)
+			{
+				arrayInsert(this->_slotAlloc, leaf->values(), leaf->count, pos, val);
+				leaf->count++;
+				return (iterator(leaf, pos));
+			}
+			mid = leafSlots / 2;
+			if (leaf->next == NULL && pos == leaf->count)
+			{
+				mid = leaf->count;
+			}
+			right = this->newLeaf();
+			arrayMove(this->_slotAlloc, right->values(), leaf->values() + mid, leaf->count - mid);
+			right->count = static_cast<unsigned short>(leaf->count - mid);
+			leaf->count = static_cast<unsigned short>(mid);
+			right->prev = leaf;
+			right->next = leaf->next;
+			if (leaf->next != NULL)
+			{
+				leaf->next->prev = right;
+			}
+			else
+			{
+				this->_last = right;
+			}
+			leaf->next = right;
+			if (pos < mid)
+			{
+				arrayInsert(this->_slotAlloc, leaf->values(), leaf->count, pos, val);
+				leaf->count++;
+			}
+			else
+			{
+				arrayInsert(this->_slotAlloc, right->values(), right->count, pos - mid, val);
+				right->count++;
+			}
+			this->insertInParent(leaf, right->values()[0]._first, right);
+			if (pos < mid)
+			{
+				return (iterator(leaf, pos));
+			}
+			return (iterator(right, pos - mid));
+		}
+
+		/*
+		* links right, whose smallest key is sep, just after left
+		*/
+		void insertInParent(NodeBase* left, const key_type& sep, NodeBase* right)
+		{
+			InnerNode*	parent = left->parent;
+			InnerNode*	newRight;
+			size_type	idx;
+			size_type	mid;
+
+			if (parent == NULL)
+			{
+				parent = this->newInner();
+				this->_keyAlloc.construct(parent->keys(), sep);
+				parent->count = 1;
+				setChild(parent, 0, left);
+				setChild(parent, 1, right);
+				this->_root = parent;
+				return ;
+			}
+			idx = left->position;
+			if (parent->count < innerSlots)
+			{
+				this->innerInsert(parent, idx, sep, right);
+				return ;
+			}
+			mid = innerSlots / 2;
+			newRight = this->newInner();
+			arrayMove(this->_keyAlloc, newRight->keys(), parent->keys() + mid + 1, parent->count - mid - 1);
+			for (size_type i = mid + 1; i <= parent->count; i++)
+			{
+				setChild(newRight, i - mid - 1, parent->children[i]);
+			}
+			newRight->count = static_cast<unsigned short>(parent->count - mid - 1);
+			parent->count = static_cast<unsigned short>(mid);
+
+			key_type	promoted(parent->keys()[mid]);
+
+			this->_keyAlloc.destroy(parent->keys() + mid);
+			if (idx <= mid)
+			{
+				this->innerInsert(parent, idx, sep, right);
+			}
+			else
+			{
+				this->innerInsert(newRight, idx - mid - 1, sep, right);
+			}
+			this->insertInParent(parent, promoted, newRight);
+		}
+
+		/*
+		* sep goes at key slot idx and child after child idx
+		*/
+		void innerInsert(InnerNode* node, size_type idx, const key_type& sep, NodeBase* child)
+		{
+			arrayInsert(this->_keyAlloc, node->keys(), node->count, idx, sep);
+			for (size_type i = node->count + 1; i > idx + 1; i--)
+			{
+				setChild(node, i, node->children[i - 1]);
+			}
+			setChild(node, idx + 1, child);
+			node->count++;
+		}
+
+		/*
+		* erasure
+		* an underfull node borrows from a sibling that can spare an entry,
+		* otherwise it is merged with it and the parent loses a separator
+		*/
+		void eraseAt(LeafNode* leaf, size_type pos)
+		{
+			this->eraseRun(leaf, pos, 1);
+		}
+
+		/*
+		* the n slots from pos go away in a single shift
+		*/
+		void eraseRun(LeafNode* leaf, size_type pos, size_type n)
+		{
+			slot_type*	values = leaf->values();
+
+			if (n == 0)
+			{
+				return ;
+			}
+			for (size_type i = pos; i + n < leaf->count; i++)
+			{
+				values[i] = values[i + n];
+			}
+			for (size_type i = leaf->count - n; i < leaf->count; i++)
+			{
+				this->_slotAlloc.destroy(values + i);
+			}
+			leaf->count = static_cast<unsigned short>(leaf->count - n);
+			this->_size -= n;
+			if (leaf == this->_root)
+			{
+				if (leaf->count == 0)
+				{
+					this->freeLeaf(leaf);
+					this->_root = NULL;
+					this->_first = NULL;
+					this->_last = NULL;
+				}
+				return ;
+			}
+			if (leaf->count < _minLeaf)
+			{
+				this->rebalanceLeaf(leaf);
+			}
+		}
+
+		/*
+		* leaf may be short of several slots after a range erasure, it
+		* borrows as many as it needs when the sibling can spare them all
+		*/
+		void rebalanceLeaf(LeafNode* leaf)
+		{
+			InnerNode*	parent = leaf->parent;
+			size_type	idx = leaf->position;
+			LeafNode*	left = (idx > 0) ? static_cast<LeafNode*>(parent->children[idx - 1]) : NULL;
+			LeafNode*	right = (idx < parent->count) ? static_cast<LeafNode*>(parent->children[idx + 1]) : NULL;
+			size_type	need = _minLeaf - leaf->count;
+
+			if (left != NULL && left->count >= _minLeaf + need)
+			{
+				for (; need > 0; need--)
+				{
+					arrayInsert(this->_slotAlloc, leaf->values(), leaf->count, 0, left->values()[left->count - 1]);
+					leaf->count++;
+					this->_slotAlloc.destroy(left->values() + left->count - 1);
+					left->count--;
+				}
+				parent->keys()[idx - 1] = leaf->values()[0]._first;
+				return ;
+			}
+			if (right != NULL && right->count >= _minLeaf + need)
+			{
+				for (; need > 0; need--)
+				{
+					this->_slotAlloc.construct(leaf->values() + leaf->count, right->values()[0]);
+					leaf->count++;
+					arrayErase(this->_slotAlloc, right->values(), right->count, 0);
+					right->count--;
+				}
+				parent->keys()[idx] = right->values()[0]._first;
+				return ;
+			}
+			if (left != NULL)
+			{
+				this->mergeLeaves(left, leaf);
+				this->innerErase(parent, idx - 1);
+			}
+			else
+			{
+				this->mergeLeaves(leaf, right);
+				this->innerErase(parent, idx);
+			}
+		}
+
+		/*
+		* right is emptied into left and freed
+		*/
+		void mergeLeaves(LeafNode* left, LeafNode* right)
+		{
+			arrayMove(this->_slotAlloc, left->values() + left->count, right->values(), right->count);
+			left->count = static_cast<unsigned short>(left->count + right->count);
+			right->count = 0;
+			left->next = right->next;
+			if (right->next != NULL)
+			{
+				right->next->prev = left;
+			}
+			else
+			{
+				this->_last = left;
+			}
+			this->freeLeaf(right);
+		}
+
+		/*
+		* drops separator idx and child idx + 1, which has been merged away
+		*/
+		void innerErase(InnerNode* node, size_type idx)
+		{
+			arrayErase(this->_keyAlloc, node->keys(), node->count, idx);
+			for (size_type i = idx + 1; i < node->count; i++)
+			{
+				setChild(node, i, node->children[i + 1]);
+			}
+			node->count--;
+			if (node == this->_root)
+			{
+				if (node->count == 0)
+				{
+					this->_root = node->children[0];
+					this->_root->parent = NULL;
+					this->_root->position = 0;
+					this->freeInner(node);
+				}
+				return ;
+			}
+			if (node->count < _minInner)
+			{
+				this->rebalanceInner(node);
+			}
+		}
+
+		void rebalanceInner(InnerNode* node)
+		{
+			InnerNode*	parent = node->parent;
+			size_type	idx = node->position;
+			InnerNode*	left = (idx > 0) ? static_cast<InnerNode*>(parent->children[idx - 1]) : NULL;
+			InnerNode*	right = (idx < parent->count) ? static_cast<InnerNode*>(parent->children[idx + 1]) : NULL;
+
+			if (left != NULL && left->count > _minInner)
+			{
+				arrayInsert(this->_keyAlloc, node->keys(), node->count, 0, parent->keys()[idx - 1]);
+				for (size_type i = node->count + 1; i > 0; i--)
+				{
+					setChild(node, i, node->children[i - 1]);
+				}
+				setChild(node, 0, left->children[left->count]);
+				node->count++;
+				parent->keys()[idx - 1] = left->keys()[left->count - 1];
+				this->_keyAlloc.destroy(left->keys() + left->count - 1);
+				left->count--;
+				return ;
+			}
+			if (right != NULL && right->count > _minInner)
+			{
+				this->_keyAlloc.construct(node->keys() + node->count, parent->keys()[idx]);
+				setChild(node, node->count + 1, right->children[0]);
+				node->count++;
+				parent->keys()[idx] = right->keys()[0];
+				arrayErase(this->_keyAlloc, right->keys(), right->count, 0);
+				for (size_type i = 0; i < right->count; i++)
+				{
+					setChild(right, i, right->children[i + 1]);
+				}
+				right->count--;
+				return ;
+			}
+			if (left != NULL)
+			{
+				this->mergeInner(left, parent->keys()[idx - 1], node);
+				this->innerErase(parent, idx - 1);
+			}
+			else
+			{
+				this->mergeInner(node, parent->keys()[idx], right);
+				this->innerErase(parent, idx);
+			}
+		}
+
+		void mergeInner(InnerNode* left, const key_type& sep, InnerNode* right)
+		{
+			size_type	base = left->count + 1;
+
+			this->_keyAlloc.construct(left->keys() + left->count, sep);
+			arrayMove(this->_keyAlloc, left->keys() + base, right->keys(), right->count);
+			for (size_type i = 0; i <= right->count; i++)
+			{
+				setChild(left, base + i, right->children[i]);
+			}
+			left->count = static_cast<unsigned short>(base + right->count);
+			right->count = 0;
+			this->freeInner(right);
+		}
+
+		/*
+		* range insertion, same policy as ft::map: sorted multi-pass ranges
+		* going into an empty map are bulk loaded
+		*/
+		template <class InputIterator>
+		void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+        {
+			while (first != last)
+            {
+				this->insert(*first);
+				first++;
+			}
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::bidirectional_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::random_access_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertSorted(ForwardIterator first, ForwardIterator last)
+        {
+			ForwardIterator	prev = first;
+			ForwardIterator	cur = first;
+			size_type		n = 1;
+
+			if (!this->empty() || first == last)
+            {
+				this->insertRange(first, last, std::input_iterator_tag());
+				return ;
+            }
+			for (++cur; cur != last; ++cur, ++prev)
+            {
+				if (this->_compare((*cur)._first, (*prev)._first))
+                {
+					this->insertRange(first, last, std::input_iterator_tag());
+					return ;
+                }
+				if (this->_compare((*prev)._first, (*cur)._first))
+                {
+					n++;
+                }
+            }
+			this->bulkLoad(first, last, n);
+		}
+
+		/*
+		* bottom-up construction of an empty tree from a sorted range holding
+		* n distinct keys, entries are spread evenly over the fewest nodes
+		* possible, level by level
+		*/
+		template <class ForwardIterator>
+		void bulkLoad(ForwardIterator first, ForwardIterator last, size_type n)
+		{
+			level_allocator_type	levelAlloc(this->_alloc);
+			size_type				width;
+			NodeBase**				level;
+			LeafNode*				prev = NULL;
+
+			if (n == 0)
+			{
+				return ;
+			}
+			width = (n + leafSlots - 1) / leafSlots;
+			level = levelAlloc.allocate(width);
+			for (size_type i = 0; i < width; i++)
+			{
+				LeafNode*	leaf = this->newLeaf();
+				size_type	fill = n / width + (i < n % width ? 1 : 0);
+
+				for (size_type j = 0; j < fill; j++)
+				{
+					this->_slotAlloc.construct(leaf->values() + j, slot_type(*first));
+					++first;
+					while (first != last && !this->_compare(leaf->values()[j]._first, (*first)._first))
+					{
+						++first;
+					}
+				}
+				leaf->count = static_cast<unsigned short>(fill);
+				leaf->prev = prev;
+				if (prev != NULL)
+				{
+					prev->next = leaf;
+				}
+				else
+				{
+					this->_first = leaf;
+				}
+				prev = leaf;
+				level[i] = leaf;
+			}
+			this->_last = prev;
+			while (width > 1)
+			{
+				size_type	parents = (width + innerSlots) / (innerSlots + 1);
+				size_type	child = 0;
+
+				for (size_type i = 0; i < parents; i++)
+				{
+					InnerNode*	inner = this->newInner();
+					size_type	fill = width / parents + (i < width % parents ? 1 : 0);
+
+					for (size_type j = 0; j < fill; j++, child++)
+					{
+						if (j > 0)
+						{
+							this->_keyAlloc.construct(inner->keys() + j - 1, this->smallestKey(level[child]));
+						}
+						setChild(inner, j, level[child]);
+					}
+					inner->count = static_cast<unsigned short>(fill - 1);
+					level[i] = inner;
+				}
+				width = parents;
+			}
+			this->_root = level[0];
+			this->_root->parent = NULL;
+			this->_size = n;
+			levelAlloc.deallocate(level, (n + leafSlots - 1) / leafSlots);
+		}
+
+		static const key_type& smallestKey(NodeBase* node)
+		{
+			while (!node->leaf)
+			{
+				node = static_cast<InnerNode*>(node)->children[0];
+			}
+			return (static_cast<LeafNode*>(node)->values()[0]._first);
+		}
+    };
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator==(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		if (lhs.size() != rhs.size())
+		{
+			return (false);
+		}
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator!=(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator<(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator<=(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator>(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	bool operator>=(const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, const ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		return (!(lhs < rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, std::size_t NodeSize>
+	void swap(ft::btree_map<Key, T, Compare, Alloc, NodeSize>& lhs, ft::btree_map<Key, T, Compare, Alloc, NodeSize>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
\ No newline at end of file
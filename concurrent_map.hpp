@@ -0,0 +1,847 @@
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# if __cplusplus >= 201103L
+
+#  include <atomic>
+#  include <memory>
+#  include <new>
+#  include <functional>
+#  include <stdexcept>
+#  include <iterator>
+#  include <cstdint>
+#  include "pair.hpp"
+#  include "epoch_reclaimer.hpp"
+
+/*
+* lock-free ordered map: a skip list whose links carry a "deleted" mark in
+* their low bit (Harris / Herlihy-Shavit)
+* - insertion is linearized by the CAS linking the node at level 0, the
+*   upper levels are linked afterwards
+* - erasure marks every link of the node, top-down, the mark on level 0
+*   is the linearization point, searches then unlink marked nodes
+* - a node is retired to the epoch reclaimer by whichever of its inserter
+*   and its remover finishes last, after a search has unlinked it everywhere
+*
+* every operation may run concurrently with any other, except the copy,
+* assignment, swap and destruction of the map itself
+* iterators are weakly consistent: they never return an element twice nor
+* one erased before they reached it, and see some of the concurrent
+* updates; an iterator keeps its thread inside an epoch section, so it has
+* to be destroyed on the thread that created it, and held iterators delay
+* reclamation
+* mapped values are not synchronized, writing through an iterator while
+* other threads read the same element is a race
+* a reference to a mapped value is only valid while an iterator to its
+* element is alive: at() returns a copy and operator[] a proxy holding
+* such an iterator, keep neither past the statement
+* every node keeps a copy of the allocator, retired nodes are freed by
+* the reclaimer after the map itself may be gone
+*
+* only available when compiling as C++11 or later
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class concurrent_map
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+		typedef Compare					key_compare;
+		typedef Alloc					allocator_type;
+
+		typedef value_type&						reference;
+		typedef const value_type&				const_reference;
+
+		static const int	maxHeight = 20;
+
+    private:
+		typedef std::uintptr_t	link_type;
+
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<char>		byte_allocator_type;
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>	value_allocator_type;
+
+		/*
+		* next has height entries, allocated along with the node
+		*/
+		struct Node: public ft::epoch_reclaimer::retired
+		{
+			std::atomic<int>		refs;
+			int						height;
+			byte_allocator_type		alloc;
+			union
+			{
+				value_type			value;
+			};
+			std::atomic<link_type>	next[1];
+
+			explicit Node(const byte_allocator_type& a): alloc(a) {}
+			~Node(void) {}
+		};
+
+		static Node* toNode(link_type l)
+		{
+			return (reinterpret_cast<Node*>(l & ~static_cast<link_type>(1)));
+		}
+
+		static link_type toLink(Node* n)
+		{
+			return (reinterpret_cast<link_type>(n));
+		}
+
+		static bool isMarked(link_type l)
+		{
+			return (l & 1);
+		}
+
+    public:
+		template <class U>
+		class ConcurrentIterator
+		{
+		public:
+			typedef U							value_type;
+			typedef std::ptrdiff_t				difference_type;
+			typedef U*							pointer;
+			typedef U&							reference;
+			typedef std::forward_iterator_tag	iterator_category;
+
+		private:
+			friend class concurrent_map;
+			Node*	_node;
+
+			void pin(void)
+			{
+				if (this->_node != NULL)
+				{
+					ft::epoch_reclaimer::instance().enter();
+				}
+			}
+
+			void unpin(void)
+			{
+				if (this->_node != NULL)
+				{
+					ft::epoch_reclaimer::instance().exit();
+				}
+			}
+
+		public:
+			ConcurrentIterator(void): _node(NULL) {}
+
+			explicit ConcurrentIterator(Node* node): _node(node)
+			{
+				this->pin();
+			}
+
+			ConcurrentIterator(const ConcurrentIterator& x): _node(x._node)
+			{
+				this->pin();
+			}
+
+			template <class V>
+			ConcurrentIterator(const ConcurrentIterator<V>& x): _node(x.getNode())
+			{
+				this->pin();
+			}
+
+			ConcurrentIterator& operator=(const ConcurrentIterator& x)
+			{
+				if (this != &x)
+				{
+					this->unpin();
+					this->_node = x._node;
+					this->pin();
+				}
+				return (*this);
+			}
+
+			~ConcurrentIterator(void)
+			{
+				this->unpin();
+			}
+
+			Node*	getNode(void) const
+			{
+				return (this->_node);
+			}
+
+			reference operator*(void) const
+			{
+				return (this->_node->value);
+			}
+
+			pointer operator->(void) const
+			{
+				return (&this->_node->value);
+			}
+
+			ConcurrentIterator& operator++(void)
+			{
+				Node*	next = concurrent_map::nextLive(this->_node);
+
+				if (next == NULL)
+				{
+					this->unpin();
+				}
+				this->_node = next;
+				return (*this);
+			}
+
+			ConcurrentIterator operator++(int)
+			{
+				ConcurrentIterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			template <class V>
+			bool operator==(const ConcurrentIterator<V>& rhs) const
+			{
+				return (this->_node == rhs.getNode());
+			}
+
+			template <class V>
+			bool operator!=(const ConcurrentIterator<V>& rhs) const
+			{
+				return (this->_node != rhs.getNode());
+			}
+		};
+
+		typedef ConcurrentIterator<value_type>			iterator;
+		typedef ConcurrentIterator<const value_type>	const_iterator;
+
+		/*
+		* what operator[] returns: the iterator keeps the element alive
+		* until the end of the statement
+		*/
+		class MappedProxy
+		{
+		private:
+			iterator	_it;
+
+		public:
+			explicit MappedProxy(const iterator& it): _it(it) {}
+
+			MappedProxy& operator=(const mapped_type& obj)
+			{
+				this->_it->_second = obj;
+				return (*this);
+			}
+
+			MappedProxy& operator=(const MappedProxy& x)
+			{
+				this->_it->_second = x._it->_second;
+				return (*this);
+			}
+
+			operator mapped_type(void) const
+			{
+				return (this->_it->_second);
+			}
+		};
+
+    private:
+		allocator_type			_alloc;
+		key_compare				_compare;
+		Node*					_head;
+		std::atomic<size_type>	_size;
+
+    public:
+		explicit concurrent_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+			_alloc(alloc),
+			_compare(comp),
+			_head(allocateNode(maxHeight)),
+			_size(0) {}
+
+		template <class InputIterator>
+		concurrent_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+			_alloc(alloc),
+			_compare(comp),
+			_head(allocateNode(maxHeight)),
+			_size(0)
+		{
+			this->insert(first, last);
+		}
+
+		/*
+		* x may be updated meanwhile, the copy then holds a weakly
+		* consistent view of it
+		*/
+		concurrent_map(const concurrent_map& x):
+			_alloc(x._alloc),
+			_compare(x._compare),
+			_head(allocateNode(maxHeight)),
+			_size(0)
+		{
+			this->insert(x.begin(), x.end());
+		}
+
+		concurrent_map& operator=(const concurrent_map& x)
+		{
+			if (this == &x)
+			{
+				return (*this);
+			}
+			this->clear();
+			this->_compare = x._compare;
+			this->insert(x.begin(), x.end());
+			return (*this);
+		}
+
+		/*
+		* no other thread may use the map any more: nodes still linked
+		* are freed directly, the ones already retired belong to the reclaimer
+		*/
+		~concurrent_map(void)
+		{
+			Node*	cur = toNode(this->_head->next[0].load(std::memory_order_acquire));
+			Node*	next;
+
+			while (cur != NULL)
+			{
+				next = toNode(cur->next[0].load(std::memory_order_relaxed));
+				destroyNode(cur);
+				cur = next;
+			}
+			freeNode(this->_head);
+		}
+
+		iterator begin(void)
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			return (iterator(nextLive(this->_head)));
+		}
+
+		const_iterator begin(void) const
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			return (const_iterator(nextLive(this->_head)));
+		}
+
+		iterator end(void)
+		{
+			return (iterator());
+		}
+
+		const_iterator end(void) const
+		{
+			return (const_iterator());
+		}
+
+		/*
+		* exact when the map is quiescent
+		*/
+		size_type size(void) const
+		{
+			return (this->_size.load(std::memory_order_relaxed));
+		}
+
+		bool empty(void) const
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			return (nextLive(this->_head) == NULL);
+		}
+
+		size_type max_size(void) const
+		{
+			return (std::allocator_traits<byte_allocator_type>::max_size(byte_allocator_type(this->_alloc)) / sizeof(Node));
+		}
+
+		MappedProxy operator[](const key_type& k)
+		{
+			return (MappedProxy(this->try_emplace(k)._first));
+		}
+
+		/*
+		* by value: the element may be erased and freed as soon as the
+		* call returns
+		*/
+		mapped_type at(const key_type& k) const
+		{
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+			{
+				throw std::out_of_range("Out of Range");
+			}
+			return (it->_second);
+		}
+
+		ft::pair<iterator, bool> insert(const value_type& val)
+		{
+			return (this->insertUnique(val._first, val));
+		}
+
+		iterator insert(const_iterator position, const value_type& val)
+		{
+			(void)position;
+			return (this->insertUnique(val._first, val)._first);
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				this->insertUnique((*first)._first, *first);
+				++first;
+			}
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k)
+		{
+			return (this->insertUnique(k, value_type(k, mapped_type())));
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k, const mapped_type& obj)
+		{
+			return (this->insertUnique(k, value_type(k, obj)));
+		}
+
+		/*
+		* removes the node position points to, not whatever holds its key:
+		* if another thread erased it and inserted the key again, the new
+		* element stays
+		*/
+		void erase(const_iterator position)
+		{
+			this->removeNode(position.getNode());
+		}
+
+		size_type erase(const key_type& k)
+		{
+			ft::epoch_reclaimer::guard	g;
+			Node*						preds[maxHeight];
+			Node*						succs[maxHeight];
+
+			if (!this->findPosition(k, preds, succs))
+			{
+				return (0);
+			}
+			return (this->removeNode(succs[0]) ? 1 : 0);
+		}
+
+		void erase(const_iterator first, const_iterator last)
+		{
+			while (first != last)
+			{
+				this->removeNode((first++).getNode());
+			}
+		}
+
+		/*
+		* element by element, concurrent inserts may survive it
+		*/
+		void clear(void)
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			for (Node* cur = nextLive(this->_head); cur != NULL; cur = nextLive(cur))
+			{
+				this->removeNode(cur);
+			}
+		}
+
+		/*
+		* neither map may be in use by other threads
+		*/
+		void swap(concurrent_map& x)
+		{
+			size_type	size = this->_size.load();
+
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_compare, x._compare);
+			std::swap(this->_head, x._head);
+			this->_size.store(x._size.load());
+			x._size.store(size);
+		}
+
+		key_compare key_comp(void) const
+		{
+			return (this->_compare);
+		}
+
+		iterator find(const key_type& k)
+		{
+			ft::epoch_reclaimer::guard	g;
+			Node*						node = this->lowerBound(k);
+
+			if (node == NULL || this->_compare(k, node->value._first))
+			{
+				return (this->end());
+			}
+			return (iterator(node));
+		}
+
+		const_iterator find(const key_type& k) const
+		{
+			return (const_cast<concurrent_map*>(this)->find(k));
+		}
+
+		size_type count(const key_type& k) const
+		{
+			ft::epoch_reclaimer::guard	g;
+			Node*						node = this->lowerBound(k);
+
+			return ((node == NULL || this->_compare(k, node->value._first)) ? 0 : 1);
+		}
+
+		iterator lower_bound(const key_type& k)
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			return (iterator(this->lowerBound(k)));
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+		{
+			ft::epoch_reclaimer::guard	g;
+
+			return (const_iterator(this->lowerBound(k)));
+		}
+
+		iterator upper_bound(const key_type& k)
+		{
+			ft::epoch_reclaimer::guard	g;
+			Node*						node = this->lowerBound(k);
+
+			if (node != NULL && !this->_compare(k, node->value._first))
+			{
+				node = nextLive(node);
+			}
+			return (iterator(node));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+		{
+			return (const_cast<concurrent_map*>(this)->upper_bound(k));
+		}
+
+		ft::pair<iterator, iterator> equal_range(const key_type& k)
+		{
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+		{
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+    private:
+		/*
+		* node memory
+		*/
+		Node* allocateNode(int height)
+		{
+			byte_allocator_type	alloc(this->_alloc);
+			std::size_t			bytes = sizeof(Node) + (height - 1) * sizeof(std::atomic<link_type>);
+			Node*				node = reinterpret_cast<Node*>(std::allocator_traits<byte_allocator_type>::allocate(alloc, bytes));
+
+			::new (static_cast<void*>(node)) Node(alloc);
+			for (int i = 1; i < height; i++)
+			{
+				::new (static_cast<void*>(&node->next[i])) std::atomic<link_type>();
+			}
+			for (int i = 0; i < height; i++)
+			{
+				node->next[i].store(0, std::memory_order_relaxed);
+			}
+			node->height = height;
+			node->refs.store(2, std::memory_order_relaxed);
+			node->deleter = &concurrent_map::retiredDeleter;
+			return (node);
+		}
+
+		static void freeNode(Node* node)
+		{
+			byte_allocator_type	alloc(node->alloc);
+			std::size_t			bytes = sizeof(Node) + (node->height - 1) * sizeof(std::atomic<link_type>);
+
+			node->~Node();
+			std::allocator_traits<byte_allocator_type>::deallocate(alloc, reinterpret_cast<char*>(node), bytes);
+		}
+
+		static void destroyNode(Node* node)
+		{
+			value_allocator_type	alloc(node->alloc);
+
+			std::allocator_traits<value_allocator_type>::destroy(alloc, &node->value);
+			freeNode(node);
+		}
+
+		static void retiredDeleter(ft::epoch_reclaimer::retired* p)
+		{
+			destroyNode(static_cast<Node*>(p));
+		}
+
+		/*
+		* geometric heights, p = 1/4
+		*/
+		static int randomHeight(void)
+		{
+			static thread_local std::uint32_t	seed = 0;
+			std::uint32_t						bits;
+			int									height = 1;
+
+			if (seed == 0)
+			{
+				seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&seed) >> 4) | 1;
+			}
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			bits = seed;
+			while ((bits & 3) == 0 && height < maxHeight)
+			{
+				height++;
+				bits >>= 2;
+			}
+			return (height);
+		}
+
+		/*
+		* searches
+		* the first live node after node at level 0, marked nodes are
+		* skipped without being unlinked
+		*/
+		static Node* nextLive(Node* node)
+		{
+			Node*	cur = toNode(node->next[0].load(std::memory_order_acquire));
+
+			while (cur != NULL && isMarked(cur->next[0].load(std::memory_order_acquire)))
+			{
+				cur = toNode(cur->next[0].load(std::memory_order_acquire));
+			}
+			return (cur);
+		}
+
+		/*
+		* read-only descent, returns the first live node whose key is not
+		* less than k
+		*/
+		Node* lowerBound(const key_type& k) const
+		{
+			Node*		pred = this->_head;
+			Node*		cur = NULL;
+			link_type	l;
+
+			for (int level = maxHeight - 1; level >= 0; level--)
+			{
+				cur = toNode(pred->next[level].load(std::memory_order_acquire));
+				while (cur != NULL)
+				{
+					l = cur->next[level].load(std::memory_order_acquire);
+					if (isMarked(l))
+					{
+						cur = toNode(l);
+						continue ;
+					}
+					if (!this->_compare(cur->value._first, k))
+					{
+						break ;
+					}
+					pred = cur;
+					cur = toNode(l);
+				}
+			}
+			return (cur);
+		}
+
+		/*
+		* fills, for every level, the last node before k and the first one
+		* not before it, unlinking the marked nodes met on the way
+		* returns whether succs[0] holds k
+		*/
+		bool findPosition(const key_type& k, Node** preds, Node** succs) const
+		{
+			Node*		pred;
+			Node*		cur;
+			link_type	l;
+			link_type	expected;
+
+		retry:
+			pred = this->_head;
+			for (int level = maxHeight - 1; level >= 0; level--)
+			{
+				cur = toNode(pred->next[level].load(std::memory_order_acquire));
+				while (cur != NULL)
+				{
+					l = cur->next[level].load(std::memory_order_acquire);
+					while (isMarked(l))
+					{
+						expected = toLink(cur);
+						if (!pred->next[level].compare_exchange_strong(expected, l & ~static_cast<link_type>(1), std::memory_order_acq_rel))
+						{
+							goto retry;
+						}
+						cur = toNode(l);
+						if (cur == NULL)
+						{
+							break ;
+						}
+						l = cur->next[level].load(std::memory_order_acquire);
+					}
+					if (cur == NULL || !this->_compare(cur->value._first, k))
+					{
+						break ;
+					}
+					pred = cur;
+					cur = toNode(l);
+				}
+				preds[level] = pred;
+				succs[level] = cur;
+			}
+			return (cur != NULL && !this->_compare(k, cur->value._first));
+		}
+
+		/*
+		* insertion
+		* the node is published at level 0, then linked level by level; a
+		* level whose link got marked meanwhile means the node is being
+		* erased and linking stops
+		*/
+		ft::pair<iterator, bool> insertUnique(const key_type& k, const value_type& val)
+		{
+			ft::epoch_reclaimer::guard	g;
+			Node*						preds[maxHeight];
+			Node*						succs[maxHeight];
+			Node*						node = NULL;
+			link_type					expected;
+			link_type					l;
+			int							height;
+
+			for (;;)
+			{
+				if (this->findPosition(k, preds, succs))
+				{
+					if (node != NULL)
+					{
+						destroyNode(node);
+					}
+					return (ft::make_pair(iterator(succs[0]), false));
+				}
+				if (node == NULL)
+				{
+					value_allocator_type	alloc(this->_alloc);
+
+					node = this->allocateNode(randomHeight());
+					std::allocator_traits<value_allocator_type>::construct(alloc, &node->value, val);
+				}
+				height = node->height;
+				for (int level = 0; level < height; level++)
+				{
+					node->next[level].store(toLink(succs[level]), std::memory_order_relaxed);
+				}
+				expected = toLink(succs[0]);
+				if (preds[0]->next[0].compare_exchange_strong(expected, toLink(node), std::memory_order_acq_rel))
+				{
+					break ;
+				}
+			}
+			this->_size.fetch_add(1, std::memory_order_relaxed);
+			for (int level = 1; level < height; level++)
+			{
+				for (;;)
+				{
+					l = node->next[level].load(std::memory_order_acquire);
+					if (isMarked(l))
+					{
+						goto linked;
+					}
+					if (toNode(l) != succs[level] && !node->next[level].compare_exchange_strong(l, toLink(succs[level]), std::memory_order_acq_rel))
+					{
+						continue ;
+					}
+					expected = toLink(succs[level]);
+					if (preds[level]->next[level].compare_exchange_strong(expected, toLink(node), std::memory_order_acq_rel))
+					{
+						break ;
+					}
+					if (!this->findPosition(k, preds, succs) || succs[0] != node)
+					{
+						goto linked;
+					}
+				}
+			}
+		linked:
+			iterator	res(node);
+
+			this->releaseNode(node);
+			return (ft::make_pair(res, true));
+		}
+
+		/*
+		* marks the links of the node from the top down, whoever marks the
+		* bottom one has removed the element
+		*/
+		bool removeNode(Node* node)
+		{
+			ft::epoch_reclaimer::guard	g;
+			link_type					l;
+
+			for (int level = node->height - 1; level > 0; level--)
+			{
+				l = node->next[level].load(std::memory_order_acquire);
+				while (!isMarked(l) && !node->next[level].compare_exchange_weak(l, l | 1, std::memory_order_acq_rel))
+				{
+				}
+			}
+			l = node->next[0].load(std::memory_order_acquire);
+			for (;;)
+			{
+				if (isMarked(l))
+				{
+					return (false);
+				}
+				if (node->next[0].compare_exchange_weak(l, l | 1, std::memory_order_acq_rel))
+				{
+					break ;
+				}
+			}
+			this->_size.fetch_sub(1, std::memory_order_relaxed);
+			this->releaseNode(node);
+			return (true);
+		}
+
+		/*
+		* the inserter and the remover each drop a reference, the last one
+		* makes sure the node is unlinked everywhere and retires it
+		*/
+		void releaseNode(Node* node)
+		{
+			Node*	preds[maxHeight];
+			Node*	succs[maxHeight];
+
+			if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			{
+				return ;
+			}
+			this->findPosition(node->value._first, preds, succs);
+			ft::epoch_reclaimer::instance().retire(node);
+		}
+    };
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(ft::concurrent_map<Key, T, Compare, Alloc>& lhs, ft::concurrent_map<Key, T, Compare, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+# endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+* ft::concurrent_map against a mutex wrapped ft::map, same mixed workload
+* (80% find, 10% insert, 10% erase over a fixed key range) with 1 to 8
+* threads
+*
+* c++ -std=c++11 -O2 -pthread concurrent_map_bench.cpp -o concurrent_map_bench
+*/
+
+#if __cplusplus < 201103L
+# error "concurrent_map_bench needs c++11"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "map.hpp"
+#include "concurrent_map.hpp"
+
+namespace
+{
+    const int       keyRange = 1 << 16;
+    const int       opsPerThread = 1 << 20;
+
+    class LockedMap
+    {
+    private:
+        ft::map<int, int>   _map;
+        std::mutex          _lock;
+
+    public:
+        bool find(int k)
+        {
+            std::lock_guard<std::mutex>     lock(this->_lock);
+
+            return (this->_map.find(k) != this->_map.end());
+        }
+
+        void insert(int k)
+        {
+            std::lock_guard<std::mutex>     lock(this->_lock);
+
+            this->_map.insert(ft::make_pair(k, k));
+        }
+
+        void erase(int k)
+        {
+            std::lock_guard<std::mutex>     lock(this->_lock);
+
+            this->_map.erase(k);
+        }
+    };
+
+    class LockFreeMap
+    {
+    private:
+        ft::concurrent_map<int, int>    _map;
+
+    public:
+        bool find(int k)
+        {
+            return (this->_map.find(k) != this->_map.end());
+        }
+
+        void insert(int k)
+        {
+            this->_map.insert(ft::make_pair(k, k));
+        }
+
+        void erase(int k)
+        {
+            this->_map.erase(k);
+        }
+    };
+
+    template <class Map>
+    void worker(Map* m, unsigned seed, long* hits)
+    {
+        unsigned    x = seed * 2654435761u + 1;
+        long        found = 0;
+        int         k;
+
+        for (int i = 0; i < opsPerThread; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            k = static_cast<int>(x % keyRange);
+            switch ((x >> 16) % 10)
+            {
+                case 0:
+                    m->insert(k);
+                    break ;
+                case 1:
+                    m->erase(k);
+                    break ;
+                default:
+                    found += m->find(k);
+            }
+        }
+        *hits = found;
+    }
+
+    template <class Map>
+    double run(int threads)
+    {
+        Map                                     m;
+        std::vector<std::thread>                pool;
+        std::vector<long>                       hits(threads);
+        std::chrono::steady_clock::time_point   start;
+
+        for (int k = 0; k < keyRange; k += 2)
+        {
+            m.insert(k);
+        }
+        start = std::chrono::steady_clock::now();
+        for (int t = 0; t < threads; t++)
+        {
+            pool.push_back(std::thread(worker<Map>, &m, t + 1, &hits[t]));
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            pool[t].join();
+        }
+        return (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+}
+
+int main(void)
+{
+    double  locked;
+    double  lockFree;
+
+    std::printf("threads  mutex ft::map (Mops/s)  ft::concurrent_map (Mops/s)\n");
+    for (int threads = 1; threads <= 8; threads *= 2)
+    {
+        locked = run<LockedMap>(threads);
+        lockFree = run<LockFreeMap>(threads);
+        std::printf("%7d  %22.2f  %27.2f\n", threads,
+            threads * (opsPerThread / 1e6) / locked,
+            threads * (opsPerThread / 1e6) / lockFree);
+    }
+    return (0);
+}
@@ -0,0 +1,16 @@
+#ifndef CONDITIONAL_HPP
+# define CONDITIONAL_HPP
+
+namespace ft
+{
+    template <bool Cond, class T, class F> struct conditional
+    {
+        typedef T type;
+    };
+    template <class T, class F> struct conditional<false, T, F>
+    {
+        typedef F type;
+    };
+}
+
+#endif
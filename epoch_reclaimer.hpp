@@ -0,0 +1,274 @@
+#ifndef EPOCH_RECLAIMER_HPP
+# define EPOCH_RECLAIMER_HPP
+
+# if __cplusplus >= 201103L
+
+#  include <atomic>
+#  include <cstddef>
+
+/*
+* epoch based memory reclamation for the lock-free containers
+* a thread reading shared nodes stays inside a critical section (enter /
+* exit, or a guard), nodes unlinked by a writer are retired instead of
+* freed: each retired node is tagged with the epoch it was retired in, and
+* freed once the global epoch has moved two steps past it, which can only
+* happen after every thread that might still see it has left its section
+* the global epoch moves forward when all the threads currently inside a
+* section have observed it
+*
+* one process-wide domain, one record per thread (records of finished
+* threads are reused along with whatever they still had to free)
+* sections nest, an iterator keeps its thread inside one for its lifetime
+*/
+
+namespace ft
+{
+    class epoch_reclaimer
+    {
+    public:
+        /*
+        * intrusive header of the objects handed to retire()
+        */
+        struct retired
+        {
+            retired*    retiredNext;
+            void        (*deleter)(retired*);
+        };
+
+        class guard
+        {
+        public:
+            guard(void)
+            {
+                epoch_reclaimer::instance().enter();
+            }
+
+            ~guard(void)
+            {
+                epoch_reclaimer::instance().exit();
+            }
+
+        private:
+            guard(const guard& x);
+            guard& operator=(const guard& x);
+        };
+
+    private:
+        static const std::size_t    _advanceEvery = 64;
+
+        struct Record
+        {
+            std::atomic<unsigned long>  state;
+            std::atomic<bool>           inUse;
+            Record*                     next;
+            unsigned                    nesting;
+            retired*                    limbo[3];
+            unsigned long               limboEpoch[3];
+            std::size_t                 retiredCount;
+        };
+
+        struct ThreadHandle
+        {
+            Record*     record;
+
+            ThreadHandle(void): record(NULL) {}
+
+            ~ThreadHandle(void)
+            {
+                if (this->record != NULL)
+                {
+                    this->record->inUse.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        std::atomic<unsigned long>  _epoch;
+        std::atomic<Record*>        _records;
+
+        epoch_reclaimer(void): _epoch(0), _records(NULL) {}
+
+        epoch_reclaimer(const epoch_reclaimer& x);
+        epoch_reclaimer& operator=(const epoch_reclaimer& x);
+
+    public:
+        /*
+        * runs at exit, when no thread is left inside a section
+        */
+        ~epoch_reclaimer(void)
+        {
+            Record*     rec = this->_records.load();
+            Record*     next;
+
+            while (rec != NULL)
+            {
+                next = rec->next;
+                for (int i = 0; i < 3; i++)
+                {
+                    freeList(rec->limbo[i]);
+                }
+                delete rec;
+                rec = next;
+            }
+        }
+
+        static epoch_reclaimer& instance(void)
+        {
+            static epoch_reclaimer  domain;
+
+            return (domain);
+        }
+
+        /*
+        * the state word is (epoch << 1) | active, it is published before
+        * the epoch is read again, so a thread never runs under an epoch the
+        * advancing threads did not see
+        */
+        void enter(void)
+        {
+            Record*         rec = this->localRecord();
+            unsigned long   e;
+            unsigned long   now;
+
+            if (rec->nesting++ > 0)
+            {
+                return ;
+            }
+            e = this->_epoch.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                rec->state.store((e << 1) | 1, std::memory_order_seq_cst);
+                now = this->_epoch.load(std::memory_order_seq_cst);
+                if (now == e)
+                {
+                    break ;
+                }
+                e = now;
+            }
+        }
+
+        void exit(void)
+        {
+            Record*     rec = this->localRecord();
+
+            if (--rec->nesting > 0)
+            {
+                return ;
+            }
+            rec->state.store(rec->state.load(std::memory_order_relaxed) & ~1ul, std::memory_order_release);
+        }
+
+        /*
+        * p must be unreachable for threads entering from now on, the caller
+        * is inside a section
+        * p is tagged with the global epoch, not the caller's one: threads
+        * may have entered under a newer epoch and still see p
+        */
+        void retire(retired* p)
+        {
+            Record*         rec = this->localRecord();
+            unsigned long   e = this->_epoch.load(std::memory_order_seq_cst);
+            std::size_t     idx = e % 3;
+
+            if (rec->limboEpoch[idx] != e)
+            {
+                freeList(rec->limbo[idx]);
+                rec->limbo[idx] = NULL;
+                rec->limboEpoch[idx] = e;
+            }
+            p->retiredNext = rec->limbo[idx];
+            rec->limbo[idx] = p;
+            if (++rec->retiredCount % _advanceEvery == 0)
+            {
+                this->tryAdvance(rec);
+            }
+        }
+
+    private:
+        static void freeList(retired* p)
+        {
+            retired*    next;
+
+            while (p != NULL)
+            {
+                next = p->retiredNext;
+                p->deleter(p);
+                p = next;
+            }
+        }
+
+        /*
+        * moves the epoch forward if every active thread is in the current
+        * one, then frees what this thread retired two epochs ago or earlier
+        */
+        void tryAdvance(Record* rec)
+        {
+            unsigned long   e = this->_epoch.load(std::memory_order_seq_cst);
+            unsigned long   s;
+
+            for (Record* r = this->_records.load(std::memory_order_acquire); r != NULL; r = r->next)
+            {
+                s = r->state.load(std::memory_order_seq_cst);
+                if ((s & 1) && (s >> 1) != e)
+                {
+                    return ;
+                }
+            }
+            this->_epoch.compare_exchange_strong(e, e + 1, std::memory_order_seq_cst);
+            e = this->_epoch.load(std::memory_order_seq_cst);
+            for (int i = 0; i < 3; i++)
+            {
+                if (rec->limbo[i] != NULL && rec->limboEpoch[i] + 2 <= e)
+                {
+                    freeList(rec->limbo[i]);
+                    rec->limbo[i] = NULL;
+                }
+            }
+        }
+
+        /*
+        * the record of the calling thread: a free one is adopted, otherwise
+        * a new one is pushed on the list, records are never unlinked
+        */
+        Record* localRecord(void)
+        {
+            static thread_local ThreadHandle    handle;
+            Record*                             rec;
+            bool                                expected;
+
+            if (handle.record != NULL)
+            {
+                return (handle.record);
+            }
+            for (rec = this->_records.load(std::memory_order_acquire); rec != NULL; rec = rec->next)
+            {
+                expected = false;
+                if (!rec->inUse.load(std::memory_order_relaxed)
+                    && rec->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    handle.record = rec;
+                    return (rec);
+                }
+            }
+            rec = new Record;
+            rec->state.store(0, std::memory_order_relaxed);
+            rec->inUse.store(true, std::memory_order_relaxed);
+            rec->nesting = 0;
+            rec->retiredCount = 0;
+            for (int i = 0; i < 3; i++)
+            {
+                rec->limbo[i] = NULL;
+                rec->limboEpoch[i] = 0;
+            }
+            rec->next = this->_records.load(std::memory_order_relaxed);
+            while (!this->_records.compare_exchange_weak(rec->next, rec, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            handle.record = rec;
+            return (rec);
+        }
+    };
+}
+
+# endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,441 @@
+#ifndef FROZEN_MAP_HPP
+# define FROZEN_MAP_HPP
+
+# include <functional>
+# include <stdexcept>
+# include <memory>
+# include <cstddef>
+# include <algorithm>
+# include "pair.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "equal.hpp"
+
+/*
+* read-only sorted map built by map::freeze()
+* the keys sit in one array in Eytzinger order (the implicit tree of a
+* heap: the children of slot k are 2k and 2k + 1, slot 0 is unused) and
+* the elements in a second array indexed the same way
+* a lookup reads one key per level and moves to 2k + (key is greater)
+* without branching, it prefetches the keys of the level a cache line of
+* keys further down (four levels for 4-byte keys); the element is only
+* touched once found
+* iteration walks the implicit tree in order
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Compare, class Alloc, class Augment>
+    class map;
+
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class frozen_map
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+		typedef Compare					key_compare;
+		typedef Alloc					allocator_type;
+
+		typedef const value_type&				reference;
+		typedef const value_type&				const_reference;
+		typedef typename Alloc::const_pointer	pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+
+		/*
+		* holds a slot, 0 being end()
+		*/
+		class const_iterator
+        {
+        public:
+			typedef const ft::pair<const Key, T>		value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef value_type*							pointer;
+			typedef value_type&							reference;
+			typedef ft::bidirectional_iterator_tag		iterator_category;
+
+        private:
+			const value_type*	_values;
+			size_type			_size;
+			size_type			_slot;
+
+        public:
+			const_iterator(void): _values(NULL), _size(0), _slot(0) {}
+
+			const_iterator(const value_type* values, size_type size, size_type slot): _values(values), _size(size), _slot(slot) {}
+
+			reference operator*(void) const
+            {
+				return (this->_values[this->_slot]);
+			}
+
+			pointer operator->(void) const
+            {
+				return (&this->_values[this->_slot]);
+			}
+
+			const_iterator& operator++(void)
+            {
+				this->_slot = frozen_map::nextSlot(this->_slot, this->_size);
+				return (*this);
+			}
+
+			const_iterator operator++(int)
+            {
+				const_iterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			const_iterator& operator--(void)
+            {
+				this->_slot = frozen_map::prevSlot(this->_slot, this->_size);
+				return (*this);
+			}
+
+			const_iterator operator--(int)
+            {
+				const_iterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			bool operator==(const const_iterator& rhs) const
+            {
+				return (this->_slot == rhs._slot && this->_values == rhs._values);
+			}
+
+			bool operator!=(const const_iterator& rhs) const
+            {
+				return (!(*this == rhs));
+			}
+        };
+
+		typedef const_iterator							iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef const_reverse_iterator					reverse_iterator;
+
+    private:
+        template <class K, class V, class C, class A, class Au>
+        friend class ft::map;
+
+        typedef typename Alloc::template rebind<Key>::other	key_allocator_type;
+
+        static const size_type	_ahead = (64 / sizeof(Key) > 1) ? 64 / sizeof(Key) : 1;
+
+        allocator_type		_alloc;
+        key_allocator_type	_keyAlloc;
+        key_compare			_compare;
+        Key*				_keys;
+        value_type*			_values;
+        size_type			_size;
+
+    public:
+        explicit frozen_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _keyAlloc(alloc),
+            _compare(comp),
+            _keys(NULL),
+            _values(NULL),
+            _size(0) {}
+
+        frozen_map(const frozen_map& x):
+            _alloc(x._alloc),
+            _keyAlloc(x._keyAlloc),
+            _compare(x._compare),
+            _keys(NULL),
+            _values(NULL),
+            _size(0)
+        {
+			this->build(x.begin(), x._size);
+		}
+
+		frozen_map& operator=(const frozen_map& x)
+        {
+			frozen_map	tmp(x);
+
+			this->swap(tmp);
+			return (*this);
+		}
+
+        ~frozen_map(void)
+        {
+			this->release();
+		}
+
+        const_iterator begin(void) const
+        {
+			return (const_iterator(this->_values, this->_size, nextSlot(0, this->_size)));
+		}
+
+		const_iterator end(void) const
+        {
+			return (const_iterator(this->_values, this->_size, 0));
+		}
+
+		const_reverse_iterator rbegin(void) const
+        {
+			return (const_reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rend(void) const
+        {
+			return (const_reverse_iterator(this->begin()));
+		}
+
+        bool empty(void) const
+        {
+			return (this->_size == 0);
+		}
+
+		size_type size(void) const
+        {
+			return (this->_size);
+		}
+
+		const mapped_type& at(const key_type& k) const
+        {
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			size_type	slot = this->lowerSlot(k);
+
+			if (slot == 0 || this->_compare(k, this->_keys[slot]))
+            {
+				return (this->end());
+            }
+			return (const_iterator(this->_values, this->_size, slot));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			size_type	slot = this->lowerSlot(k);
+
+			return ((slot == 0 || this->_compare(k, this->_keys[slot])) ? 0 : 1);
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+        {
+			return (const_iterator(this->_values, this->_size, this->lowerSlot(k)));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+        {
+			return (const_iterator(this->_values, this->_size, this->upperSlot(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+        void swap(frozen_map& x)
+        {
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_keyAlloc, x._keyAlloc);
+			std::swap(this->_compare, x._compare);
+			std::swap(this->_keys, x._keys);
+			std::swap(this->_values, x._values);
+			std::swap(this->_size, x._size);
+		}
+
+        key_compare key_comp(void) const
+        {
+			return (this->_compare);
+		}
+
+        allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+    private:
+		/*
+		* the descent goes past the leaves, the slots where it went right
+		* are the low set bits of k: dropping them and one more bit gives
+		* the last slot where it went left, 0 if there is none
+		*/
+		size_type lowerSlot(const key_type& k) const
+        {
+			size_type	slot = 1;
+
+			while (slot <= this->_size)
+            {
+				prefetch(this->_keys, slot * _ahead, this->_size);
+				slot = 2 * slot + static_cast<size_type>(this->_compare(this->_keys[slot], k));
+            }
+			return (slot >> (trailingOnes(slot) + 1));
+		}
+
+		size_type upperSlot(const key_type& k) const
+        {
+			size_type	slot = 1;
+
+			while (slot <= this->_size)
+            {
+				prefetch(this->_keys, slot * _ahead, this->_size);
+				slot = 2 * slot + static_cast<size_type>(!this->_compare(k, this->_keys[slot]));
+            }
+			return (slot >> (trailingOnes(slot) + 1));
+		}
+
+		static size_type trailingOnes(size_type slot)
+        {
+# if defined(__GNUC__)
+			return (static_cast<size_type>(__builtin_ctzll(~static_cast<unsigned long long>(slot))));
+# else
+			size_type	i = 0;
+
+			while (slot & 1)
+            {
+				slot >>= 1;
+				i++;
+            }
+			return (i);
+# endif
+		}
+
+		static void prefetch(const Key* keys, size_type slot, size_type size)
+        {
+# if defined(__GNUC__)
+			if (slot <= size)
+            {
+				__builtin_prefetch(keys + slot);
+            }
+# else
+			(void)keys;
+			(void)slot;
+			(void)size;
+# endif
+		}
+
+		/*
+		* in-order walk of the implicit tree, slot 0 stands for end() on
+		* both sides
+		*/
+		static size_type nextSlot(size_type slot, size_type size)
+        {
+			if (slot == 0 || 2 * slot + 1 <= size)
+            {
+				slot = (slot == 0) ? 1 : 2 * slot + 1;
+				if (slot > size)
+                {
+					return (0);
+                }
+				while (2 * slot <= size)
+                {
+					slot *= 2;
+                }
+				return (slot);
+            }
+			while (slot & 1)
+            {
+				slot >>= 1;
+            }
+			return (slot >> 1);
+		}
+
+		static size_type prevSlot(size_type slot, size_type size)
+        {
+			if (slot == 0 || 2 * slot <= size)
+            {
+				slot = (slot == 0) ? 1 : 2 * slot;
+				if (slot > size)
+                {
+					return (0);
+                }
+				while (2 * slot + 1 <= size)
+                {
+					slot = 2 * slot + 1;
+                }
+				return (slot);
+            }
+			while (slot != 0 && !(slot & 1))
+            {
+				slot >>= 1;
+            }
+			return (slot >> 1);
+		}
+
+		/*
+		* fills the slots in order from n sorted elements, slot 0 of both
+		* arrays is never constructed
+		*/
+		template <class InputIterator>
+		void build(InputIterator first, size_type n)
+        {
+			size_type	slot;
+
+			if (n == 0)
+            {
+				return ;
+            }
+			this->_keys = this->_keyAlloc.allocate(n + 1);
+			this->_values = this->_alloc.allocate(n + 1);
+			for (slot = nextSlot(0, n); slot != 0; slot = nextSlot(slot, n))
+            {
+				this->_keyAlloc.construct(this->_keys + slot, (*first)._first);
+				this->_alloc.construct(this->_values + slot, value_type((*first)._first, (*first)._second));
+				++first;
+            }
+			this->_size = n;
+		}
+
+		void release(void)
+        {
+			size_type	slot;
+
+			if (this->_keys == NULL)
+            {
+				return ;
+            }
+			for (slot = 1; slot <= this->_size; slot++)
+            {
+				this->_keyAlloc.destroy(this->_keys + slot);
+				this->_alloc.destroy(this->_values + slot);
+            }
+			this->_keyAlloc.deallocate(this->_keys, this->_size + 1);
+			this->_alloc.deallocate(this->_values, this->_size + 1);
+			this->_keys = NULL;
+			this->_values = NULL;
+			this->_size = 0;
+		}
+    };
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator==(const ft::frozen_map<Key, T, Compare, Alloc>& lhs, const ft::frozen_map<Key, T, Compare, Alloc>& rhs)
+    {
+		if (lhs.size() != rhs.size())
+        {
+			return (false);
+        }
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!=(const ft::frozen_map<Key, T, Compare, Alloc>& lhs, const ft::frozen_map<Key, T, Compare, Alloc>& rhs)
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(ft::frozen_map<Key, T, Compare, Alloc>& lhs, ft::frozen_map<Key, T, Compare, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>
+# include <string>
+
+/*
+* default hash functors for the unordered containers
+* the values are not mixed, the tables take care of spreading them
+*/
+
+namespace ft
+{
+    template <class T>
+    struct hash;
+
+    template <class T>
+    struct integral_hash
+    {
+        typedef T               argument_type;
+        typedef std::size_t     result_type;
+
+        std::size_t operator()(T x) const
+        {
+            return (static_cast<std::size_t>(x));
+        }
+    };
+
+    /*
+    * FNV-1a over the object representation
+    */
+    inline std::size_t hash_bytes(const void* data, std::size_t len)
+    {
+        const unsigned char*    p = static_cast<const unsigned char*>(data);
+        std::size_t             h = 2166136261u;
+
+        for (std::size_t i = 0; i < len; i++)
+        {
+            h ^= p[i];
+            h *= 16777619u;
+        }
+        return (h);
+    }
+
+    /*
+    * hashed as a double: +0 and -0 must collide, and long double has
+    * padding bytes with unspecified contents
+    */
+    template <class T>
+    struct floating_hash
+    {
+        typedef T               argument_type;
+        typedef std::size_t     result_type;
+
+        std::size_t operator()(T x) const
+        {
+            double  d = static_cast<double>(x);
+
+            if (d == 0)
+            {
+                return (0);
+            }
+            return (ft::hash_bytes(&d, sizeof(d)));
+        }
+    };
+
+    template<> struct hash<bool>: public integral_hash<bool> {};
+    template<> struct hash<char>: public integral_hash<char> {};
+    template<> struct hash<wchar_t>: public integral_hash<wchar_t> {};
+    template<> struct hash<signed char>: public integral_hash<signed char> {};
+    template<> struct hash<short int>: public integral_hash<short int> {};
+    template<> struct hash<int>: public integral_hash<int> {};
+    template<> struct hash<long int>: public integral_hash<long int> {};
+    template<> struct hash<unsigned char>: public integral_hash<unsigned char> {};
+    template<> struct hash<unsigned short int>: public integral_hash<unsigned short int> {};
+    template<> struct hash<unsigned int>: public integral_hash<unsigned int> {};
+    template<> struct hash<unsigned long int>: public integral_hash<unsigned long int> {};
+
+    template<> struct hash<float>: public floating_hash<float> {};
+    template<> struct hash<double>: public floating_hash<double> {};
+    template<> struct hash<long double>: public floating_hash<long double> {};
+
+    template <class T>
+    struct hash<T*>
+    {
+        typedef T*              argument_type;
+        typedef std::size_t     result_type;
+
+        std::size_t operator()(T* p) const
+        {
+            return (reinterpret_cast<std::size_t>(p));
+        }
+    };
+
+    template <>
+    struct hash<std::string>
+    {
+        typedef std::string     argument_type;
+        typedef std::size_t     result_type;
+
+        std::size_t operator()(const std::string& s) const
+        {
+            return (ft::hash_bytes(s.data(), s.size()));
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,681 @@
+#ifndef HASH_TABLE_HPP
+# define HASH_TABLE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <iterator>
+# include <algorithm>
+# include "pair.hpp"
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+
+/*
+* open addressing table shared by unordered_map and unordered_set
+* every slot has a control byte: EMPTY, or the low 7 bits of the hash (H2)
+* of the element it holds, the remaining bits (H1) pick the home slot
+* collisions are resolved by linear probing, the control bytes being
+* matched 16 at a time: one SSE2 compare finds every H2 candidate in a group
+* and the first empty slot, which ends the search
+* erasing shifts the rest of the probe run back over the hole, so there are
+* no tombstones and lookups never slow down with churn
+*
+* layout of the control bytes for a table of capacity 2^k - 1:
+*   [ capacity control bytes ][ SENTINEL ][ copy of the first 15 bytes ]
+* the copy lets a group be loaded from any slot without wrapping by hand,
+* the sentinel stops iteration and is never EMPTY nor a match
+*/
+
+namespace ft
+{
+    template <class Value, class Key, class KeyOfValue, class Hash, class Pred, class Alloc>
+    class HashTable
+    {
+    public:
+        typedef Value           value_type;
+        typedef Key             key_type;
+        typedef Hash            hasher;
+        typedef Pred            key_equal;
+        typedef std::size_t     size_type;
+        typedef signed char     ctrl_type;
+
+        typedef typename Alloc::template rebind<Value>::other       allocator_type;
+        typedef typename Alloc::template rebind<ctrl_type>::other   ctrl_allocator_type;
+
+        static const ctrl_type  EMPTY = -128;
+        static const ctrl_type  SENTINEL = -1;
+        static const size_type  groupWidth = 16;
+
+        /*
+        * a control byte and its slot, end() sits on the sentinel
+        */
+        template <class U>
+        class HashTableIterator
+        {
+        public:
+            typedef U                           value_type;
+            typedef std::ptrdiff_t              difference_type;
+            typedef U*                          pointer;
+            typedef U&                          reference;
+            typedef std::forward_iterator_tag   iterator_category;
+
+        private:
+            friend class HashTable;
+            ctrl_type*  _ctrl;
+            Value*      _slot;
+
+        public:
+            HashTableIterator(void): _ctrl(NULL), _slot(NULL) {}
+
+            HashTableIterator(ctrl_type* ctrl, Value* slot): _ctrl(ctrl), _slot(slot) {}
+
+            template <class V>
+            HashTableIterator(const HashTableIterator<V>& x): _ctrl(x.getCtrl()), _slot(x.getSlot()) {}
+
+            ctrl_type*  getCtrl(void) const
+            {
+                return (this->_ctrl);
+            }
+
+            Value*  getSlot(void) const
+            {
+                return (this->_slot);
+            }
+
+            reference operator*(void) const
+            {
+                return (*this->_slot);
+            }
+
+            pointer operator->(void) const
+            {
+                return (this->_slot);
+            }
+
+            HashTableIterator& operator++(void)
+            {
+                this->_ctrl++;
+                this->_slot++;
+                this->skipEmpty();
+                return (*this);
+            }
+
+            HashTableIterator operator++(int)
+            {
+                HashTableIterator   tmp(*this);
+
+                ++(*this);
+                return (tmp);
+            }
+
+            void skipEmpty(void)
+            {
+                while (*this->_ctrl == EMPTY)
+                {
+                    this->_ctrl++;
+                    this->_slot++;
+                }
+            }
+
+            template <class V>
+            bool operator==(const HashTableIterator<V>& rhs) const
+            {
+                return (this->_ctrl == rhs.getCtrl());
+            }
+
+            template <class V>
+            bool operator!=(const HashTableIterator<V>& rhs) const
+            {
+                return (this->_ctrl != rhs.getCtrl());
+            }
+        };
+
+        typedef HashTableIterator<Value>        iterator;
+        typedef HashTableIterator<const Value>  const_iterator;
+
+    private:
+        /*
+        * 16 control bytes loaded at once, the masks have bit i set when
+        * byte i matches
+        */
+        struct Group
+        {
+# if defined(__SSE2__)
+            __m128i ctrl;
+
+            explicit Group(const ctrl_type* p): ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+            unsigned match(ctrl_type h2) const
+            {
+                return (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl))));
+            }
+# else
+            const ctrl_type*    ctrl;
+
+            explicit Group(const ctrl_type* p): ctrl(p) {}
+
+            unsigned match(ctrl_type h2) const
+            {
+                unsigned    mask = 0;
+
+                for (size_type i = 0; i < groupWidth; i++)
+                {
+                    if (this->ctrl[i] == h2)
+                    {
+                        mask |= 1u << i;
+                    }
+                }
+                return (mask);
+            }
+# endif
+
+            unsigned matchEmpty(void) const
+            {
+                return (this->match(EMPTY));
+            }
+        };
+
+        static size_type lowestBit(unsigned mask)
+        {
+# if defined(__GNUC__)
+            return (static_cast<size_type>(__builtin_ctz(mask)));
+# else
+            size_type   i = 0;
+
+            while (!(mask & 1u))
+            {
+                mask >>= 1;
+                i++;
+            }
+            return (i);
+# endif
+        }
+
+        allocator_type      _alloc;
+        ctrl_allocator_type _ctrlAlloc;
+        hasher              _hash;
+        key_equal           _equal;
+        KeyOfValue          _key;
+        ctrl_type*          _ctrl;
+        Value*              _slots;
+        size_type           _capacity;
+        size_type           _size;
+        size_type           _growthLeft;
+
+    public:
+        explicit HashTable(const hasher& hf = hasher(), const key_equal& eql = key_equal(), const Alloc& alloc = Alloc()):
+            _alloc(alloc),
+            _ctrlAlloc(alloc),
+            _hash(hf),
+            _equal(eql),
+            _key(),
+            _ctrl(emptyGroup()),
+            _slots(NULL),
+            _capacity(0),
+            _size(0),
+            _growthLeft(0) {}
+
+        /*
+        * same capacity, so every element goes to the slot it had in x
+        * and nothing is hashed again
+        */
+        HashTable(const HashTable& x):
+            _alloc(x._alloc),
+            _ctrlAlloc(x._ctrlAlloc),
+            _hash(x._hash),
+            _equal(x._equal),
+            _key(x._key),
+            _ctrl(emptyGroup()),
+            _slots(NULL),
+            _capacity(0),
+            _size(0),
+            _growthLeft(0)
+        {
+            this->copyFrom(x);
+        }
+
+        HashTable& operator=(const HashTable& x)
+        {
+            if (this == &x)
+            {
+                return (*this);
+            }
+            this->clear();
+            this->deallocateTable();
+            this->_hash = x._hash;
+            this->_equal = x._equal;
+            this->copyFrom(x);
+            return (*this);
+        }
+
+        ~HashTable(void)
+        {
+            this->clear();
+            this->deallocateTable();
+        }
+
+        iterator begin(void)
+        {
+            iterator    it(this->_ctrl, this->_slots);
+
+            it.skipEmpty();
+            return (it);
+        }
+
+        const_iterator begin(void) const
+        {
+            return (const_cast<HashTable*>(this)->begin());
+        }
+
+        iterator end(void)
+        {
+            return (iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity));
+        }
+
+        const_iterator end(void) const
+        {
+            return (const_cast<HashTable*>(this)->end());
+        }
+
+        size_type getSize(void) const
+        {
+            return (this->_size);
+        }
+
+        size_type getCapacity(void) const
+        {
+            return (this->_capacity);
+        }
+
+        size_type max_size(void) const
+        {
+            return (this->_alloc.max_size());
+        }
+
+        hasher hash_function(void) const
+        {
+            return (this->_hash);
+        }
+
+        key_equal key_eq(void) const
+        {
+            return (this->_equal);
+        }
+
+        allocator_type get_allocator(void) const
+        {
+            return (this->_alloc);
+        }
+
+        iterator iteratorAt(size_type idx)
+        {
+            return (iterator(this->_ctrl + idx, this->_slots + idx));
+        }
+
+        size_type indexOf(const_iterator it) const
+        {
+            return (static_cast<size_type>(it.getCtrl() - this->_ctrl));
+        }
+
+        /*
+        * lookup
+        */
+        size_type findIndex(const key_type& k) const
+        {
+            size_type   h = this->hashOf(k);
+            ctrl_type   h2 = static_cast<ctrl_type>(h & 0x7F);
+            size_type   pos = (h >> 7) & this->_capacity;
+            unsigned    match;
+            unsigned    empty;
+            size_type   idx;
+
+            for (;;)
+            {
+                Group   g(this->_ctrl + pos);
+
+                match = g.match(h2);
+                empty = g.matchEmpty();
+                if (empty)
+                {
+                    match &= (empty & (0u - empty)) - 1;
+                }
+                while (match)
+                {
+                    idx = (pos + lowestBit(match)) & this->_capacity;
+                    if (this->_equal(this->_key(this->_slots[idx]), k))
+                    {
+                        return (idx);
+                    }
+                    match &= match - 1;
+                }
+                if (empty)
+                {
+                    return (this->_capacity);
+                }
+                pos = (pos + groupWidth) & this->_capacity;
+            }
+        }
+
+        iterator find(const key_type& k)
+        {
+            return (this->iteratorAt(this->findIndex(k)));
+        }
+
+        const_iterator find(const key_type& k) const
+        {
+            return (const_cast<HashTable*>(this)->find(k));
+        }
+
+        /*
+        * insertion, in two steps so callers can build the value only once
+        * they know the key is missing: prepareInsert() returns the slot of k
+        * if it is there, or grows the table if needed and returns the free
+        * slot that will receive it
+        */
+        bool prepareInsert(const key_type& k, size_type& idx, ctrl_type& h2)
+        {
+            size_type   h;
+
+            idx = this->findIndex(k);
+            if (idx != this->_capacity)
+            {
+                return (true);
+            }
+            if (this->_growthLeft == 0)
+            {
+                this->rehash(this->_size + 1);
+            }
+            h = this->hashOf(k);
+            h2 = static_cast<ctrl_type>(h & 0x7F);
+            idx = this->findEmpty(h);
+            return (false);
+        }
+
+        iterator constructAt(size_type idx, ctrl_type h2, const value_type& val)
+        {
+            this->_alloc.construct(this->_slots + idx, val);
+            this->setCtrl(idx, h2);
+            this->_size++;
+            this->_growthLeft--;
+            return (this->iteratorAt(idx));
+        }
+
+        ft::pair<iterator, bool> insertUnique(const value_type& val)
+        {
+            size_type   idx;
+            ctrl_type   h2;
+
+            if (this->prepareInsert(this->_key(val), idx, h2))
+            {
+                return (ft::make_pair(this->iteratorAt(idx), false));
+            }
+            return (ft::make_pair(this->constructAt(idx, h2, val), true));
+        }
+
+        /*
+        * erasure: the elements following the hole in its probe run are
+        * moved back into it when their home slot allows, until an empty
+        * slot ends the run
+        */
+        void eraseIndex(size_type idx)
+        {
+            size_type   hole = idx;
+            size_type   home;
+
+            this->_alloc.destroy(this->_slots + idx);
+            for (size_type j = (idx + 1) & this->_capacity; this->_ctrl[j] != EMPTY; j = (j + 1) & this->_capacity)
+            {
+                if (j == this->_capacity)
+                {
+                    continue ;
+                }
+                home = (this->hashOf(this->_key(this->_slots[j])) >> 7) & this->_capacity;
+                if (((j - home) & this->_capacity) >= ((j - hole) & this->_capacity))
+                {
+                    this->_alloc.construct(this->_slots + hole, this->_slots[j]);
+                    this->_alloc.destroy(this->_slots + j);
+                    this->setCtrl(hole, this->_ctrl[j]);
+                    hole = j;
+                }
+            }
+            this->setCtrl(hole, EMPTY);
+            this->_size--;
+            this->_growthLeft++;
+        }
+
+        /*
+        * for erasure through an iterator: the slot of the erased element
+        * now holds the next one to visit, or is empty and the iterator
+        * moves on; the elements shifted back come from later slots, so an
+        * erase-as-you-go walk skips none of them, only one shifted from the
+        * front of the table into its end, by a probe run that wraps
+        * around, is seen a second time
+        */
+        iterator eraseAt(size_type idx)
+        {
+            iterator    it = this->iteratorAt(idx);
+
+            this->eraseIndex(idx);
+            it.skipEmpty();
+            return (it);
+        }
+
+        size_type eraseKey(const key_type& k)
+        {
+            size_type   idx = this->findIndex(k);
+
+            if (idx == this->_capacity)
+            {
+                return (0);
+            }
+            this->eraseIndex(idx);
+            return (1);
+        }
+
+        /*
+        * keeps the storage
+        */
+        void clear(void)
+        {
+            if (this->_capacity == 0)
+            {
+                return ;
+            }
+            for (size_type i = 0; i < this->_capacity; i++)
+            {
+                if (this->_ctrl[i] != EMPTY)
+                {
+                    this->_alloc.destroy(this->_slots + i);
+                }
+            }
+            this->resetCtrl();
+            this->_size = 0;
+            this->_growthLeft = maxLoad(this->_capacity);
+        }
+
+        void swap(HashTable& x)
+        {
+            std::swap(this->_alloc, x._alloc);
+            std::swap(this->_ctrlAlloc, x._ctrlAlloc);
+            std::swap(this->_hash, x._hash);
+            std::swap(this->_equal, x._equal);
+            std::swap(this->_ctrl, x._ctrl);
+            std::swap(this->_slots, x._slots);
+            std::swap(this->_capacity, x._capacity);
+            std::swap(this->_size, x._size);
+            std::swap(this->_growthLeft, x._growthLeft);
+        }
+
+        /*
+        * makes room for n elements without further rehashing
+        */
+        void reserve(size_type n)
+        {
+            if (n <= this->_size + this->_growthLeft)
+            {
+                return ;
+            }
+            this->rehash(n);
+        }
+
+        /*
+        * moves every element to a table sized for at least n elements
+        */
+        void rehash(size_type n)
+        {
+            size_type   capacity = groupWidth - 1;
+            ctrl_type*  oldCtrl = this->_ctrl;
+            Value*      oldSlots = this->_slots;
+            size_type   oldCapacity = this->_capacity;
+            size_type   h;
+            size_type   idx;
+
+            if (n < this->_size)
+            {
+                n = this->_size;
+            }
+            while (maxLoad(capacity) < n)
+            {
+                capacity = capacity * 2 + 1;
+            }
+            if (capacity == oldCapacity)
+            {
+                return ;
+            }
+            this->allocateTable(capacity);
+            for (size_type i = 0; i < oldCapacity; i++)
+            {
+                if (oldCtrl[i] != EMPTY)
+                {
+                    h = this->hashOf(this->_key(oldSlots[i]));
+                    idx = this->findEmpty(h);
+                    this->_alloc.construct(this->_slots + idx, oldSlots[i]);
+                    this->_alloc.destroy(oldSlots + i);
+                    this->setCtrl(idx, static_cast<ctrl_type>(h & 0x7F));
+                }
+            }
+            this->_growthLeft = maxLoad(capacity) - this->_size;
+            if (oldCapacity != 0)
+            {
+                this->_ctrlAlloc.deallocate(oldCtrl, oldCapacity + groupWidth);
+                this->_alloc.deallocate(oldSlots, oldCapacity);
+            }
+        }
+
+        /*
+        * at most 7/8 of the slots are used
+        */
+        static size_type maxLoad(size_type capacity)
+        {
+            return (capacity - capacity / 8);
+        }
+
+    private:
+        /*
+        * the hash is mixed so that weak hashes, like the identity ft::hash
+        * uses for integers, still spread over the low bits used as H1 and H2
+        */
+        size_type hashOf(const key_type& k) const
+        {
+            size_type   h = this->_hash(k);
+
+            h ^= h >> 16;
+            h *= 0x45d9f3bu;
+            h ^= h >> 16;
+            h *= 0x45d9f3bu;
+            h ^= h >> 16;
+            return (h);
+        }
+
+        size_type findEmpty(size_type h) const
+        {
+            size_type   pos = (h >> 7) & this->_capacity;
+            unsigned    empty;
+
+            for (;;)
+            {
+                empty = Group(this->_ctrl + pos).matchEmpty();
+                if (empty)
+                {
+                    return ((pos + lowestBit(empty)) & this->_capacity);
+                }
+                pos = (pos + groupWidth) & this->_capacity;
+            }
+        }
+
+        void setCtrl(size_type idx, ctrl_type c)
+        {
+            this->_ctrl[idx] = c;
+            if (idx < groupWidth - 1)
+            {
+                this->_ctrl[this->_capacity + 1 + idx] = c;
+            }
+        }
+
+        void resetCtrl(void)
+        {
+            for (size_type i = 0; i < this->_capacity + groupWidth; i++)
+            {
+                this->_ctrl[i] = EMPTY;
+            }
+            this->_ctrl[this->_capacity] = SENTINEL;
+        }
+
+        /*
+        * the table of an empty container: a lone sentinel, so lookups and
+        * iteration work without a special case and without allocating
+        */
+        static ctrl_type* emptyGroup(void)
+        {
+            static ctrl_type    group[groupWidth] = {SENTINEL, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY,
+                EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY};
+
+            return (group);
+        }
+
+        void allocateTable(size_type capacity)
+        {
+            this->_ctrl = this->_ctrlAlloc.allocate(capacity + groupWidth);
+            this->_slots = this->_alloc.allocate(capacity);
+            this->_capacity = capacity;
+            this->resetCtrl();
+        }
+
+        /*
+        * the elements must have been destroyed
+        */
+        void deallocateTable(void)
+        {
+            if (this->_capacity != 0)
+            {
+                this->_ctrlAlloc.deallocate(this->_ctrl, this->_capacity + groupWidth);
+                this->_alloc.deallocate(this->_slots, this->_capacity);
+            }
+            this->_ctrl = emptyGroup();
+            this->_slots = NULL;
+            this->_capacity = 0;
+            this->_growthLeft = 0;
+        }
+
+        void copyFrom(const HashTable& x)
+        {
+            if (x._size == 0)
+            {
+                return ;
+            }
+            this->allocateTable(x._capacity);
+            std::copy(x._ctrl, x._ctrl + x._capacity + groupWidth, this->_ctrl);
+            for (size_type i = 0; i < x._capacity; i++)
+            {
+                if (x._ctrl[i] != EMPTY)
+                {
+                    this->_alloc.construct(this->_slots + i, x._slots[i]);
+                }
+            }
+            this->_size = x._size;
+            this->_growthLeft = x._growthLeft;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
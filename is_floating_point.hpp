@@ -0,0 +1,20 @@
+#ifndef IS_FLOATING_POINT_HPP
+# define IS_FLOATING_POINT_HPP
+
+# include "is_integral.hpp"
+
+namespace ft
+{
+    template <typename T>
+    struct is_floating_point : public integral_constant<false, T> {};
+
+    template<> struct is_floating_point<float>: public integral_constant<true, float> {};
+    template<> struct is_floating_point<double>: public integral_constant<true, double> {};
+    template<> struct is_floating_point<long double>: public integral_constant<true, long double> {};
+
+    template<> struct is_floating_point<const float>: public integral_constant<true, const float> {};
+    template<> struct is_floating_point<const double>: public integral_constant<true, const double> {};
+    template<> struct is_floating_point<const long double>: public integral_constant<true, const long double> {};
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef IS_TRANSPARENT_HPP
+# define IS_TRANSPARENT_HPP
+
+namespace ft
+{
+    /*
+    * true when Compare declares an is_transparent member type, i.e. it can
+    * compare keys with other types (std::less<> and friends in c++14)
+    * the associative containers then accept those types for lookups
+    * K is not used, it makes the test depend on the parameter of a member
+    * template so that enable_if drops the member instead of failing
+    */
+    template <class Compare, class K = void>
+    struct is_transparent
+    {
+    private:
+        struct No
+        {
+            char    c[2];
+        };
+
+        template <class U>
+        static char test(typename U::is_transparent*);
+        template <class U>
+        static No   test(...);
+
+    public:
+        static const bool value = (sizeof(test<Compare>(0)) == sizeof(char));
+    };
+}
+
+#endif
@@ -1,48 +1,48 @@
-#ifndef ITERATOR_TRAITS_HPP
-# define ITERATOR_TRAITS_HPP
-
-# include "./iterator.hpp"
-
-/*
-* generic definition
-* specialization with objects
-* specialization with const objects
-*/
-
-namespace ft
-{
-    template <class Iterator>
-    class iterator_traits
-    {
-    public:
-        typedef typename Iterator::difference_type      difference_type;
-        typedef typename Iterator::value_type           value_type;
-        typedef typename Iterator::pointer              pointer;
-        typedef typename Iterator::reference            reference;
-        typedef typename Iterator::iterator_category    iterator_category;
-    };
-
-    template <class T>
-    class iterator_traits<T*>
-    {
-    public:
-        typedef std::ptrdiff_t              difference_type;
-        typedef T                           value_type;
-        typedef T*                          pointer;
-        typedef T&                          reference;
-        typedef random_access_iterator_tag  iterator_category;
-    };
-
-    template <class T>
-    class iterator_traits<const T*>
-    {
-    public:
-        typedef std::ptrdiff_t              difference_type;
-        typedef T                           value_type;
-        typedef const T*                    pointer;
-        typedef const T&                    reference;
-        typedef random_access_iterator_tag  iterator_category;
-    };
-}
-
+#ifndef ITERATOR_TRAITS_HPP
+# define ITERATOR_TRAITS_HPP
+
+# include "./iterator.hpp"
+
+/*
+* generic definition
+* specialization with objects
+* specialization with const objects
+*/
+
+namespace ft
+{
+    template <class Iterator>
+    class iterator_traits
+    {
+    public:
+        typedef typename Iterator::difference_type      difference_type;
+        typedef typename Iterator::value_type           value_type;
+        typedef typename Iterator::pointer              pointer;
+        typedef typename Iterator::reference            reference;
+        typedef typename Iterator::iterator_category    iterator_category;
+    };
+
+    template <class T>
+    class iterator_traits<T*>
+    {
+    public:
+        typedef std::ptrdiff_t              difference_type;
+        typedef T                           value_type;
+        typedef T*                          pointer;
+        typedef T&                          reference;
+        typedef random_access_iterator_tag  iterator_category;
+    };
+
+    template <class T>
+    class iterator_traits<const T*>
+    {
+    public:
+        typedef std::ptrdiff_t              difference_type;
+        typedef T                           value_type;
+        typedef const T*                    pointer;
+        typedef const T&                    reference;
+        typedef random_access_iterator_tag  iterator_category;
+    };
+}
+
 #endif
\ No newline at end of file
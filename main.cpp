@@ -0,0 +1,56 @@
+#include <iostream>
+#include "tests/tests.hpp"
+
+namespace
+{
+    struct Suite
+    {
+        const char*     name;
+        void            (*run)(void);
+    };
+
+    const Suite     suites[] =
+    {
+        {"map lookup", ft_test::mapLookup},
+        {"map insert", ft_test::mapInsert},
+        {"map allocator", ft_test::mapAllocator},
+        {"map iterators", ft_test::mapIterators},
+        {"map balance", ft_test::mapBalance},
+        {"map build", ft_test::mapBuild},
+        {"map clear", ft_test::mapClear},
+        {"map copy", ft_test::mapCopy},
+        {"map set algebra", ft_test::mapSetAlgebra},
+        {"map split", ft_test::mapSplit},
+        {"map node handles", ft_test::mapNodeHandle},
+        {"map transparent lookup", ft_test::mapTransparent},
+        {"map finger search", ft_test::mapFinger},
+        {"map find batch", ft_test::mapFindBatch},
+        {"map native order", ft_test::mapNativeOrder},
+        {"map erase", ft_test::mapErase},
+        {"map erase stability", ft_test::mapEraseStability},
+        {"map order statistics", ft_test::mapOrderStatistics},
+        {"map aggregate", ft_test::mapAggregate},
+        {"btree_map", ft_test::btreeMap},
+        {"unordered_map", ft_test::unorderedMap},
+        {"unordered_set", ft_test::unorderedSet},
+        {"persistent_map", ft_test::persistentMap},
+        {"frozen_map", ft_test::frozenMap},
+        {"radix_map", ft_test::radixMap},
+#if __cplusplus >= 201103L
+        {"concurrent_map", ft_test::concurrentMap},
+#endif
+    };
+}
+
+int main(void)
+{
+    int     before;
+
+    for (std::size_t i = 0; i < sizeof(suites) / sizeof(suites[0]); i++)
+    {
+        before = ft_test::failures;
+        suites[i].run();
+        std::cout << suites[i].name << ": " << (ft_test::failures == before ? "ok" : "FAILED") << std::endl;
+    }
+    return (ft_test::failures != 0);
+}
@@ -1,340 +1,1006 @@
-#ifndef MAP_HPP
-# define MAP_HPP
-
-# include <functional>
-# include "pair.hpp"
-# include "reverse_iterator.hpp"
-# include "bidirectional_iterator.hpp"
-# include "binary_search_tree.hpp"
-# include "enable_if.hpp"
-# include "is_integral.hpp"
-
-namespace ft
-{
-    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
-    class map 
-    {
-    public:
-        typedef Key						key_type;
-		typedef T						mapped_type;
-		typedef ft::pair<const Key, T>	value_type;
-		typedef std::size_t				size_type;
-		typedef std::ptrdiff_t			difference_type;
-		typedef Compare					key_compare;
-		typedef Alloc					allocator_type;
-
-		typedef value_type&						reference;
-		typedef const value_type&				const_reference;
-		typedef typename Alloc::pointer			pointer;
-		typedef typename Alloc::const_pointer	const_pointer;
-
-		typedef typename ft::BST<Key, T, Compare>::iterator					iterator;
-		typedef typename ft::BST<Key, T, Compare>::const_iterator			const_iterator;
-		typedef typename ft::BST<Key, T, Compare>::reverse_iterator			reverse_iterator;
-		typedef typename ft::BST<Key, T, Compare>::const_reverse_iterator   const_reverse_iterator;
-
-        class value_compare: public std::binary_function<value_type, value_type, bool>
-        {
-        public:
-            typedef bool		result_type;
-			typedef value_type	first_argument_type;
-			typedef value_type	second_argument_type;
-
-			bool operator()(const value_type&x, const value_type& y) const
-            {
-				return (this->_comp(x.first, y.first));
-			}
-
-        protected:
-			Compare		_comp;
-
-			value_compare(Compare c) : _comp(c) {};
-        };
-
-    private:
-        allocator_type          _alloc;
-        key_compare             _compare;
-        BST<Key, T, Compare>    _bst;
-
-    public:
-        explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
-
-		template <class InputIterator>
-		map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
-		
-        map(const map& x);
-		
-        ~map(void);
-	    
-        map& operator=(const map& x);
-
-        iterator					begin(void);
-		const_iterator				begin(void) const;
-		iterator					end(void);
-		const_iterator				end(void) const;
-		reverse_iterator			rbegin(void);
-		const_reverse_iterator		rbegin(void) const;
-		reverse_iterator			rend(void);
-		const_reverse_iterator		rend(void) const;
-
-        bool	    empty(void) const;
-		size_type	size(void) const;
-		size_type	max_size(void) const;
-
-        mapped_type&		operator [] (const key_type& k);
-		mapped_type&		at(const key_type& k);
-		const mapped_type&	at(const key_type& k) const;
-
-        pair<iterator, bool>	insert(const value_type& val);
-		iterator				insert(iterator position, const value_type& val);
-		template <class InputIterator>
-		void					insert(InputIterator first, InputIterator last);
-		void		erase(iterator position);
-		size_type	erase(const key_type& k);
-		void		erase(iterator first, iterator last);
-		void		swap(map& x);
-		void		clear(void);
-
-        key_compare		key_comp(void) const;
-		value_compare	value_comp(void) const;
-
-        iterator			find(const key_type& k);
-		const_iterator		find(const key_type& k) const;
-		size_type			count(const key_type& k) const;
-		iterator			lower_bound(const key_type& k);
-		const_iterator		lower_bound(const key_type& k) const;
-		iterator			upper_bound(const key_type& k);
-		const_iterator		upper_bound(const key_type& k) const;
-		pair<const_iterator, const_iterator>	equal_range(const key_type& k) const;
-		pair<iterator, iterator>				equal_range(const key_type& k);
-
-        allocator_type get_allocator(void) const;
-
-        explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
-			_bst(comp, alloc),
-            _alloc(alloc),
-            _compare(comp) {}
-
-        template <class InputIterator>
-		map(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last, 
-			const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
-             _bst(comp, alloc),
-             _alloc(alloc),
-             _compare(comp)
-        {
-	        while (first != last) 
-            {
-		    	this->_bst.insertNode(first->pair);
-		    	first++;
-		    }
-		}
-
-        map(const map& x): _bst(x._compare, x._alloc), _alloc(x._alloc), _compare(x._compare)
-        {
-			*this = x;
-		}
-
-		map& operator=(const map& x) 
-        {
-		    if (this == &x)
-            {
-		    	return (*this);
-            }
-
-		    for (iterator it = x.begin(); it != x.end(); it++)
-            {
-		    	this->_bst.insertNode(*it);
-            }
-		    return (*this);
-		}
-
-        ~map(void) {}
-
-        iterator begin(void) 
-        {
-			return (iterator(this->_bst.minimum(this->_bst.getRoot())));
-		}
-
-		const_iterator begin(void) const 
-        {
-			return (const_iterator(this->_bst.minimum(this->_bst.getRoot())));
-		}
-
-		iterator end(void) 
-        {
-			return (iterator(this->_bst.maximum(this->_bst.getRoot())));
-		}
-
-		const_iterator end(void) const 
-        {
-			return (const_iterator(this->_bst.maximum(this->_bst.getRoot())));
-		}
-
-		reverse_iterator rbegin(void) 
-        {
-			return (reverse_iterator(this->_bst.maximum(this->_bst.getRoot())));
-		}
-
-		const_reverse_iterator	rbegin(void) const 
-        {
-			return (const_reverse_iterator(this->_bst.maximum(this->_bst.getRoot())));
-		}
-
-		reverse_iterator rend(void) 
-        {
-			return (reverse_iterator(this->_bst.minimum(this->_bst.getRoot())));
-		}
-
-		const_reverse_iterator	rend(void) const 
-        {
-			return (const_reverse_iterator(this->_bst.minimum(this->_bst.getRoot())));
-		}
-
-        bool empty(void) const 
-        {
-				if (this->_bst.getSize() == 0)
-                {
-						return (true);
-                }
-				return (false);
-		}
-
-		size_type size(void) const 
-        {
-			return (this->_bst.getSize());
-		}
-
-		size_type max_size(void) const
-        {
-			return (this->_alloc.max_size());
-		}
-
-        mapped_type& operator[](const key_type& k) 
-        {
-			iterator	it = this->_bst.find(k);
-
-			return (it->pair._first);
-		}
-
-		mapped_type& at(const key_type& k)
-        {
-			iterator it = this->_bst.find(k);
-
-			if (it->_ptr == this->_bst.getNull())
-            {
-				throw std::out_of_range("Out of Range");
-            }
-			return (it->pair._first);
-		}
-
-		const mapped_type& at(const key_type& k) const 
-        {
-			iterator	it = this->_bst.find(k);
-
-			if (it->_ptr == this->_bst.getNull())
-            {
-				throw std::out_of_range("Out of Range");
-            }
-			return (it->pair._first);
-		}
-
-        ft::pair<iterator, bool> insert(const value_type& val) 
-        {
-			bool		isNew;
-			iterator	it;
-
-			isNew = this->_bst.insertNode(val);
-			it = this->_bst.find(val->_first);
-			return (ft::make_pair(it, isNew));
-        }
-
-        iterator insert(iterator position, const value_type& val) 
-        {
-			iterator	it;
-
-			this->_bst.insertNode(val);
-			it = this->_bst.find(val->_first);
-			return (it);
-		}
-
-        template <class InputIterator>
-		void insert (typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last) 
-        {
-			while (first != last) 
-            {
-				this->_bst.insertNode(first->pair);
-				first++;
-			}
-		}
-
-        void erase(iterator position)
-        {
-			his->_bst.deleteNode(position->pair._first);
-		}
-
-        size_type erase(const key_type& k) 
-        {
-			if (this->_bst.deleteNode(k))
-            {
-				return (1);
-            }
-			return (0);
-		}
-
-        void erase(iterator first, iterator last) 
-        {
-			while (first != last) 
-            {
-				this->_bst.deleteNode(first->pair._first);
-				first++;
-		    }
-		}
-
-        void swap(map& x) 
-        {
-			BST<Key, T, Compare> tmp;
-
-			tmp = this->_bst;
-			this->_bst = x._bst;
-			x._bst = tmp;
-		}
-
-        void clear(void) 
-        {
-			if (this->_bst.getRoot() != NULL)
-            {
-				this->_bst.clearTree();
-            }
-		}
-
-        key_compare key_comp(void) const
-        {
-			return (this->_compare);
-		}
-
-		value_compare value_comp(void) const
-        {
-			return (value_compare());
-		}
-
-
-    };
-
-    template <class Key, class T, class Compare, class Alloc>
-	bool operator==(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!=(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<=(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>=(const ft::map<Key, T, Compare, Alloc>& lhs, const ft::map<Key, T, Compare, Alloc>& rhs);
-
-    template <class Key, class T, class Compare, class Alloc>
-	void swap(ft::map<Key, T, Compare, Alloc>& lhs, ft::map<Key, T, Compare, Alloc>& rhs);
-}
-
+#ifndef MAP_HPP
+# define MAP_HPP
+
+# include <functional>
+# include <stdexcept>
+# include <iterator>
+# include <algorithm>
+# include "pair.hpp"
+# include "reverse_iterator.hpp"
+# include "iterator_traits.hpp"
+# include "binary_search_tree.hpp"
+# include "tree_augment.hpp"
+# include "node_handle.hpp"
+# include "frozen_map.hpp"
+# include "enable_if.hpp"
+# include "conditional.hpp"
+# include "is_integral.hpp"
+# include "is_transparent.hpp"
+# include "equal.hpp"
+# include "lexicographical_compare.hpp"
+
+namespace ft
+{
+    /*
+    * Augment picks the per-node data kept by the tree (tree_augment.hpp):
+    * with ft::order_statistics, nth / rank / count_range are O(log n),
+    * with ft::monoid_augment, aggregate is; the aggregates are computed
+    * from the mapped values, so iterators, operator[] and at() only give
+    * const access to them and they change through insert_or_assign or
+    * update, which refresh the aggregates on the way
+    */
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >, class Augment = ft::no_augment>
+    class map 
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+		typedef Compare					key_compare;
+		typedef Alloc					allocator_type;
+
+		typedef typename ft::conditional<Augment::reads_values, const value_type&, value_type&>::type	reference;
+		typedef const value_type&				const_reference;
+		typedef typename Alloc::pointer			pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+
+		/*
+		* what operator[] and at() return, const when Augment reads the
+		* mapped values
+		*/
+		typedef typename ft::conditional<Augment::reads_values, const T&, T&>::type	mapped_reference;
+
+		typedef typename Alloc::template rebind<ft::Node<Key, T, Augment> >::other	node_allocator_type;
+		typedef ft::BST<Key, T, Compare, node_allocator_type, Augment>				tree_type;
+
+		typedef typename ft::conditional<Augment::reads_values, typename tree_type::const_iterator, typename tree_type::iterator>::type	iterator;
+		typedef typename tree_type::const_iterator			const_iterator;
+		typedef ft::reverse_iterator<iterator>				reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator	const_reverse_iterator;
+
+		typedef ft::node_handle<Key, T, ft::Node<Key, T, Augment>, node_allocator_type, Alloc>	node_type;
+
+		/*
+		* result of insert(node_type): on a key already present, node still
+		* owns the element and position points to the one in the map
+		*/
+		struct insert_return_type
+		{
+			iterator	position;
+			bool		inserted;
+			node_type	node;
+		};
+
+        class value_compare
+        {
+			friend class map;
+
+        public:
+            typedef bool		result_type;
+			typedef value_type	first_argument_type;
+			typedef value_type	second_argument_type;
+
+			bool operator()(const value_type&x, const value_type& y) const
+            {
+				return (this->_comp(x._first, y._first));
+			}
+
+        protected:
+			Compare		_comp;
+
+			value_compare(Compare c) : _comp(c) {};
+        };
+
+    private:
+        typedef typename tree_type::NodePtr  node_pointer;
+
+        allocator_type          _alloc;
+        key_compare             _compare;
+        tree_type               _bst;
+        bool                    _fingerOn;
+        node_pointer            _finger;
+
+    public:
+        explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _compare(comp),
+			_bst(comp, alloc),
+            _fingerOn(false),
+            _finger(NULL) {}
+
+        template <class InputIterator>
+		map(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last, 
+			const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+             _alloc(alloc),
+             _compare(comp),
+             _bst(comp, alloc),
+             _fingerOn(false),
+             _finger(NULL)
+        {
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+        map(const map& x): _alloc(x._alloc), _compare(x._compare), _bst(x._bst), _fingerOn(x._fingerOn), _finger(NULL) {}
+
+		map& operator=(const map& x) 
+        {
+		    if (this == &x)
+            {
+		    	return (*this);
+            }
+
+			this->_bst = x._bst;
+			this->_compare = x._compare;
+			this->_finger = NULL;
+		    return (*this);
+		}
+
+# if __cplusplus >= 201103L
+		map(map&& x): _alloc(x._alloc), _compare(x._compare), _bst(static_cast<tree_type&&>(x._bst)), _fingerOn(x._fingerOn), _finger(NULL)
+        {
+			x._finger = NULL;
+		}
+
+		map& operator=(map&& x)
+        {
+			this->swap(x);
+		    return (*this);
+		}
+# endif
+
+        ~map(void) {}
+
+        iterator begin(void) 
+        {
+			return (iterator(this->_bst.getLeftmost()));
+		}
+
+		const_iterator begin(void) const 
+        {
+			return (const_iterator(this->_bst.getLeftmost()));
+		}
+
+		iterator end(void) 
+        {
+			return (iterator(this->_bst.getHeader()));
+		}
+
+		const_iterator end(void) const 
+        {
+			return (const_iterator(this->_bst.getHeader()));
+		}
+
+		reverse_iterator rbegin(void) 
+        {
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator	rbegin(void) const 
+        {
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend(void) 
+        {
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator	rend(void) const 
+        {
+			return (const_reverse_iterator(this->begin()));
+		}
+
+        bool empty(void) const 
+        {
+				if (this->_bst.getRoot() == NULL)
+                {
+						return (true);
+                }
+				return (false);
+		}
+
+		/*
+		* O(1), except for the first call after split or extract_range
+		* without order_statistics, which counts the elements in O(n)
+		*/
+		size_type size(void) const 
+        {
+			return (this->_bst.getSize());
+		}
+
+		size_type max_size(void) const
+        {
+			return (this->_alloc.max_size());
+		}
+
+		/*
+		* pre-sizes the node pool so the next n insertions don't allocate
+		*/
+		void reserve(size_type n)
+        {
+			this->_bst.reserve(n);
+		}
+
+		/*
+		* finger mode, for workloads where a lookup usually lands next to
+		* the previous one: the map remembers the last node found or
+		* inserted and find, lower_bound, insert, operator[] and the upserts
+		* start from it (see BST::fingerLowerBound), which costs O(log d)
+		* for a key d elements away instead of O(log n)
+		* the finger is forgotten by anything that removes elements; const
+		* lookups start from it but leave it where it is, so concurrent
+		* readers of a const map never write to it
+		*/
+		void finger_search(bool on)
+        {
+			this->_fingerOn = on;
+			this->_finger = NULL;
+		}
+
+		/*
+		* a finger kept by the caller, independent of the map's own one:
+		* lookups and insertions through a cursor start from the element it
+		* last found or inserted, it is invalidated like an iterator to
+		* that element
+		*/
+		class cursor
+        {
+        private:
+			map*			_map;
+			node_pointer	_node;
+
+        public:
+			explicit cursor(map& m): _map(&m), _node(NULL) {}
+
+			cursor(map& m, iterator position): _map(&m), _node(position.getNode()) {}
+
+			iterator position(void) const
+            {
+				if (this->_node == NULL)
+                {
+					return (this->_map->end());
+                }
+				return (iterator(this->_node));
+			}
+
+			iterator lower_bound(const key_type& k)
+            {
+				this->_node = this->_map->_bst.fingerLowerBound(this->_node, k);
+				return (iterator(this->_node));
+			}
+
+			iterator find(const key_type& k)
+            {
+				iterator	it = this->lower_bound(k);
+
+				if (it == this->_map->end() || this->_map->_compare(k, it->_first))
+                {
+					return (this->_map->end());
+                }
+				return (it);
+			}
+
+			ft::pair<iterator, bool> insert(const value_type& val)
+            {
+				node_pointer	parent;
+				bool			left;
+				node_pointer	node = this->_map->_bst.fingerInsertPosition(this->_node, val._first, parent, left);
+
+				if (node != NULL)
+                {
+					this->_node = node;
+					return (ft::make_pair(iterator(node), false));
+                }
+				this->_node = this->_map->_bst.attachNode(parent, left, val);
+				return (ft::make_pair(iterator(this->_node), true));
+			}
+        };
+
+        mapped_reference operator[](const key_type& k) 
+        {
+			node_pointer	parent;
+			bool			left;
+			node_pointer	node = this->insertPosition(k, parent, left);
+
+			if (node == NULL)
+            {
+				node = this->_bst.attachNode(parent, left, ft::pair<Key, T>(k, mapped_type()));
+            }
+			this->touch(node);
+			return (node->pair._second);
+		}
+
+		mapped_reference at(const key_type& k)
+        {
+			node_pointer	node = this->_bst.searchNode(k);
+
+			if (node == this->_bst.getHeader())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (node->pair._second);
+		}
+
+		const mapped_type& at(const key_type& k) const 
+        {
+			node_pointer	node = this->_bst.searchNode(k);
+
+			if (node == this->_bst.getHeader())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (node->pair._second);
+		}
+
+        ft::pair<iterator, bool> insert(const value_type& val) 
+        {
+			node_pointer	parent;
+			bool			left;
+			node_pointer	node = this->insertPosition(val._first, parent, left);
+
+			if (node != NULL)
+            {
+				this->touch(node);
+				return (ft::make_pair(iterator(node), false));
+            }
+			node = this->_bst.attachNode(parent, left, val);
+			this->touch(node);
+			return (ft::make_pair(iterator(node), true));
+        }
+
+        iterator insert(iterator position, const value_type& val) 
+        {
+			return (iterator(this->_bst.insertNode(position, val)._first));
+		}
+
+		/*
+		* upserts: the mapped value is only built (or assigned) after the
+		* single descent made by insertPosition told us whether k exists
+		*/
+		ft::pair<iterator, bool> try_emplace(const key_type& k)
+        {
+			node_pointer	parent;
+			bool			left;
+			node_pointer	node = this->insertPosition(k, parent, left);
+
+			if (node != NULL)
+            {
+				this->touch(node);
+				return (ft::make_pair(iterator(node), false));
+            }
+			node = this->_bst.attachNode(parent, left, ft::pair<Key, T>(k, mapped_type()));
+			this->touch(node);
+			return (ft::make_pair(iterator(node), true));
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k, const mapped_type& obj)
+        {
+			node_pointer	parent;
+			bool			left;
+			node_pointer	node = this->insertPosition(k, parent, left);
+
+			if (node != NULL)
+            {
+				this->touch(node);
+				return (ft::make_pair(iterator(node), false));
+            }
+			node = this->_bst.attachNode(parent, left, ft::pair<Key, T>(k, obj));
+			this->touch(node);
+			return (ft::make_pair(iterator(node), true));
+		}
+
+		ft::pair<iterator, bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+        {
+			node_pointer	parent;
+			bool			left;
+			node_pointer	node = this->insertPosition(k, parent, left);
+
+			if (node != NULL)
+            {
+				node->pair._second = obj;
+				this->_bst.updatePath(node);
+				this->touch(node);
+				return (ft::make_pair(iterator(node), false));
+            }
+			node = this->_bst.attachNode(parent, left, ft::pair<Key, T>(k, obj));
+			this->touch(node);
+			return (ft::make_pair(iterator(node), true));
+		}
+
+		/*
+		* assigns obj to the element of key k, if any, and refreshes the
+		* aggregates on its path (see aggregate)
+		*/
+		bool update(const key_type& k, const mapped_type& obj)
+        {
+			node_pointer	node = this->findNode(k);
+
+			if (node == this->_bst.getHeader())
+            {
+				return (false);
+            }
+			node->pair._second = obj;
+			this->_bst.updatePath(node);
+			return (true);
+		}
+
+        template <class InputIterator>
+		void insert (typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last) 
+        {
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+        void erase(iterator position)
+        {
+			this->_finger = NULL;
+			this->_bst.eraseNode(position.getNode());
+		}
+
+        size_type erase(const key_type& k) 
+        {
+			this->_finger = NULL;
+			if (this->_bst.deleteNode(k))
+            {
+				return (1);
+            }
+			return (0);
+		}
+
+        void erase(iterator first, iterator last) 
+        {
+			this->_finger = NULL;
+			if (first != last)
+            {
+				this->_bst.eraseRange(first.getNode(), last.getNode());
+            }
+		}
+
+		/*
+		* with a transparent Compare (see is_transparent.hpp) the lookups
+		* below take anything Compare orders against key_type, no key_type
+		* is built for them
+		*/
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type erase(const K& k)
+        {
+			this->_finger = NULL;
+			if (this->_bst.deleteNode(k))
+            {
+				return (1);
+            }
+			return (0);
+		}
+
+        void swap(map& x) 
+        {
+			this->_bst.swap(x._bst);
+			std::swap(this->_compare, x._compare);
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_fingerOn, x._fingerOn);
+			this->_finger = NULL;
+			x._finger = NULL;
+		}
+
+        void clear(void) 
+        {
+			this->_finger = NULL;
+			if (this->_bst.getRoot() != NULL)
+            {
+				this->_bst.clearTree();
+            }
+		}
+
+		/*
+		* set algebra, in place, in O(m log(n / m + 1)) for sizes m <= n
+		* unite adds the elements of x whose key is missing here, intersect
+		* keeps only the keys also in x, subtract removes them
+		* the nodes of this map that stay are not moved, x is left untouched
+		*/
+		void unite(const map& x)
+        {
+			this->_bst.uniteWith(x._bst);
+		}
+
+		void intersect(const map& x)
+        {
+			this->_finger = NULL;
+			this->_bst.intersectWith(x._bst);
+		}
+
+		void subtract(const map& x)
+        {
+			this->_finger = NULL;
+			this->_bst.subtractWith(x._bst);
+		}
+
+		/*
+		* moving elements between maps, in O(log n) without copying nor
+		* allocating: the nodes are relinked, and the receiving map keeps the
+		* slabs they were carved from alive (node_pool::adopt), those slabs
+		* are given back once every map holding them is gone
+		* the maps share no allocator state but these reference counts, they
+		* may be used from different threads afterwards
+		* split keeps the keys less than k and returns the others,
+		* extract_range returns the keys in [lo, hi)
+		* join takes all the elements of x, in O(log n) when the keys of
+		* both maps do not interleave, otherwise x's nodes are relinked in
+		* one by one, and x's elements whose key is here already destroyed
+		* iterators to the moved elements stay valid, they now belong to the
+		* other map
+		* the pieces keep their size only with order_statistics, otherwise
+		* the first size() on either map after a split counts its elements
+		*/
+		map split(const key_type& k)
+        {
+			map	res(this->_compare, this->_alloc);
+
+			this->_finger = NULL;
+			this->_bst.splitInto(k, res._bst);
+			return (res);
+		}
+
+		map extract_range(const key_type& lo, const key_type& hi)
+        {
+			map	res(this->_compare, this->_alloc);
+
+			this->_finger = NULL;
+			this->_bst.extractRangeInto(lo, hi, res._bst);
+			return (res);
+		}
+
+		void join(map& x)
+        {
+			x._finger = NULL;
+			this->_bst.joinWith(x._bst);
+		}
+
+		/*
+		* node handles (node_handle.hpp): extract unlinks an element without
+		* destroying it, insert links it into this map or another one of
+		* the same type, neither copies the element, extract does not
+		* allocate and insert allocates at most one slab header, when this
+		* map has to keep the handle's storage alive along with the one it
+		* already keeps for earlier moves
+		* merge moves every element of x whose key is missing here and
+		* leaves the others in x
+		* iterators to the moved elements stay valid, they now belong to
+		* this map
+		*/
+		node_type extract(iterator position)
+        {
+			node_type	nh(this->_alloc);
+
+			this->_finger = NULL;
+			this->_bst.lendPool(nh._pool);
+			nh._node = this->_bst.unlinkNode(position.getNode());
+			return (nh);
+		}
+
+		node_type extract(const key_type& k)
+        {
+			iterator	position = this->find(k);
+
+			if (position == this->end())
+            {
+				return (node_type(this->_alloc));
+            }
+			return (this->extract(position));
+		}
+
+# if __cplusplus >= 201103L
+		insert_return_type insert(node_type&& nh)
+        {
+			return (this->insertHandle(nh));
+		}
+# else
+		insert_return_type insert(const node_type& nh)
+        {
+			return (this->insertHandle(const_cast<node_type&>(nh)));
+		}
+# endif
+
+		void merge(map& x)
+        {
+			x._finger = NULL;
+			this->_bst.mergeFrom(x._bst);
+		}
+
+		/*
+		* read-only copy laid out for lookups (frozen_map.hpp), in O(n)
+		*/
+		ft::frozen_map<Key, T, Compare, Alloc> freeze(void) const
+        {
+			ft::frozen_map<Key, T, Compare, Alloc>	res(this->_compare, this->_alloc);
+
+			res.build(this->begin(), this->size());
+			return (res);
+		}
+
+        key_compare key_comp(void) const
+        {
+			return (this->_compare);
+		}
+
+		value_compare value_comp(void) const
+        {
+			return (value_compare(this->_compare));
+		}
+
+		iterator find(const key_type& k)
+        {
+			return (iterator(this->findNode(k)));
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			return (const_iterator(this->findNode(k)));
+		}
+
+		/*
+		* find for every key of [first, last), results go to out in the
+		* same order (end() for a missing key), the descents are interleaved
+		* to hide the memory latency of large maps
+		*/
+		template <class ForwardIterator, class OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        {
+			return (this->_bst.template findBatch<iterator>(first, last, out));
+		}
+
+		template <class ForwardIterator, class OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        {
+			return (this->_bst.template findBatch<const_iterator>(first, last, out));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			if (this->_bst.searchNode(k) == this->_bst.getHeader())
+            {
+				return (0);
+            }
+			return (1);
+		}
+
+		iterator lower_bound(const key_type& k)
+        {
+			return (iterator(this->lowerBoundNode(k)));
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+        {
+			return (const_iterator(this->lowerBoundNode(k)));
+		}
+
+		iterator upper_bound(const key_type& k)
+        {
+			return (iterator(this->_bst.upperBound(k)));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+        {
+			return (const_iterator(this->_bst.upperBound(k)));
+		}
+
+		ft::pair<iterator, iterator> equal_range(const key_type& k)
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type find(const K& k)
+        {
+			return (iterator(this->findNode(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type find(const K& k) const
+        {
+			return (const_iterator(this->findNode(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type count(const K& k) const
+        {
+			if (this->_bst.searchNode(k) == this->_bst.getHeader())
+            {
+				return (0);
+            }
+			return (1);
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type lower_bound(const K& k)
+        {
+			return (iterator(this->lowerBoundNode(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type lower_bound(const K& k) const
+        {
+			return (const_iterator(this->lowerBoundNode(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type upper_bound(const K& k)
+        {
+			return (iterator(this->_bst.upperBound(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type upper_bound(const K& k) const
+        {
+			return (const_iterator(this->_bst.upperBound(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, ft::pair<iterator, iterator> >::type equal_range(const K& k)
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<Compare, K>::value, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		/*
+		* order statistics, only available with Augment = ft::order_statistics
+		* nth(n) is the element of index n in key order (end() if n >= size()),
+		* rank(k) the number of keys less than k
+		*/
+		iterator nth(size_type n)
+        {
+			return (iterator(this->_bst.selectNode(n)));
+		}
+
+		const_iterator nth(size_type n) const
+        {
+			return (const_iterator(this->_bst.selectNode(n)));
+		}
+
+		size_type rank(const key_type& k) const
+        {
+			return (this->_bst.rankOf(k));
+		}
+
+		/*
+		* number of keys in [lo, hi)
+		*/
+		size_type count_range(const key_type& lo, const key_type& hi) const
+        {
+			if (!this->_compare(lo, hi))
+            {
+				return (0);
+            }
+			return (this->_bst.rankOf(hi) - this->_bst.rankOf(lo));
+		}
+
+		/*
+		* combination of the elements with keys in [lo, hi), in O(log n),
+		* Augment has to describe an aggregate (ft::monoid_augment, or
+		* ft::order_statistics which counts)
+		* the aggregates are cached in the nodes, which is why a map with
+		* ft::monoid_augment only changes mapped values through
+		* insert_or_assign and update
+		*/
+		typename Augment::aggregate_type aggregate(const key_type& lo, const key_type& hi) const
+        {
+			if (!this->_compare(lo, hi))
+            {
+				return (Augment::identity());
+            }
+			return (this->_bst.aggregateRange(lo, hi));
+		}
+
+    private:
+		/*
+		* lookups and insertion slots, through the finger when it is on
+		*/
+		template <class K>
+		node_pointer lowerBoundNode(const K& k)
+        {
+			if (!this->_fingerOn)
+            {
+				return (this->_bst.lowerBound(k));
+            }
+			this->_finger = this->_bst.fingerLowerBound(this->_finger, k);
+			return (this->_finger);
+		}
+
+		template <class K>
+		node_pointer lowerBoundNode(const K& k) const
+        {
+			if (!this->_fingerOn)
+            {
+				return (this->_bst.lowerBound(k));
+            }
+			return (this->_bst.fingerLowerBound(this->_finger, k));
+		}
+
+		template <class K>
+		node_pointer findNode(const K& k)
+        {
+			return (this->matchNode(this->lowerBoundNode(k), k));
+		}
+
+		template <class K>
+		node_pointer findNode(const K& k) const
+        {
+			return (this->matchNode(this->lowerBoundNode(k), k));
+		}
+
+		template <class K>
+		node_pointer matchNode(node_pointer node, const K& k) const
+        {
+			if (node == this->_bst.getHeader() || this->_compare(k, node->pair._first))
+            {
+				return (this->_bst.getHeader());
+            }
+			return (node);
+		}
+
+		node_pointer insertPosition(const key_type& k, node_pointer& parent, bool& left) const
+        {
+			if (!this->_fingerOn)
+            {
+				return (this->_bst.insertPosition(k, parent, left));
+            }
+			return (this->_bst.fingerInsertPosition(this->_finger, k, parent, left));
+		}
+
+		void touch(node_pointer node)
+        {
+			if (this->_fingerOn)
+            {
+				this->_finger = node;
+            }
+		}
+
+		insert_return_type insertHandle(node_type& nh)
+        {
+			insert_return_type		res;
+			ft::pair<node_pointer, bool>	ret;
+
+			if (nh.empty())
+            {
+				res.position = this->end();
+				res.inserted = false;
+				return (res);
+            }
+			this->_bst.adoptPool(nh._pool);
+			ret = this->_bst.insertNode(nh._node);
+			res.position = iterator(ret._first);
+			res.inserted = ret._second;
+			if (ret._second)
+            {
+				nh._node = NULL;
+            }
+			else
+            {
+				res.node.swap(nh);
+            }
+			return (res);
+		}
+
+		/*
+		* range insertion: multi-pass ranges are first scanned, when they are
+		* sorted the tree is built in linear time if the map is empty, and
+		* otherwise a tree built from the range has its nodes spliced in
+		* anything else is inserted one by one with end() as hint, which is
+		* O(1) amortized for keys arriving in increasing order
+		*/
+		template <class InputIterator>
+		void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+        {
+			while (first != last) 
+            {
+				this->_bst.insertNode(this->end(), *first);
+				first++;
+			}
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::bidirectional_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::random_access_iterator_tag)
+        {
+			this->insertSorted(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertSorted(ForwardIterator first, ForwardIterator last)
+        {
+			ForwardIterator	prev = first;
+			ForwardIterator	cur = first;
+			size_type		n = 1;
+
+			if (first == last)
+            {
+				return ;
+            }
+			for (++cur; cur != last; ++cur, ++prev)
+            {
+				if (this->_compare((*cur)._first, (*prev)._first))
+                {
+					this->insertRange(first, last, std::input_iterator_tag());
+					return ;
+                }
+				if (this->_compare((*prev)._first, (*cur)._first))
+                {
+					n++;
+                }
+            }
+			this->_bst.uniteSorted(first, last, n);
+		}
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator==(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		if (lhs.size() != rhs.size())
+		{
+        	return (false);
+        }
+        return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator!=(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<=(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>=(const ft::map<Key, T, Compare, Alloc, Augment>& lhs, const ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		return (!(lhs < rhs));
+	}
+
+    template <class Key, class T, class Compare, class Alloc, class Augment>
+	void swap(ft::map<Key, T, Compare, Alloc, Augment>& lhs, ft::map<Key, T, Compare, Alloc, Augment>& rhs);
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	void swap(ft::map<Key, T, Compare, Alloc, Augment>& lhs, ft::map<Key, T, Compare, Alloc, Augment>& rhs) 
+    {
+		lhs.swap(rhs);
+	}
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,137 @@
+#ifndef NODE_HANDLE_HPP
+# define NODE_HANDLE_HPP
+
+# include <memory>
+# include <algorithm>
+# include "node_pool.hpp"
+
+/*
+* owning handle on a tree node taken out of a map (map::extract), it can be
+* linked back into any map of the same type (map::insert) without copying
+* the element nor allocating
+* the handle's pool holds a reference on the node storage of the map it
+* comes from (node_pool::adopt), so the node stays valid when that map goes
+* away before the handle
+* move only in c++11, in c++98 copying a handle takes its node away from
+* the source the way std::auto_ptr does
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Compare, class Alloc, class Augment>
+    class map;
+
+    template <class Key, class T, class Node, class NodeAlloc, class Alloc>
+    class node_handle
+    {
+    public:
+        typedef Key		key_type;
+		typedef T		mapped_type;
+		typedef Alloc	allocator_type;
+
+    private:
+        template <class K, class V, class C, class A, class Au>
+        friend class ft::map;
+
+        Node*							_node;
+        allocator_type					_alloc;
+        ft::node_pool<Node, NodeAlloc>	_pool;
+
+    public:
+        node_handle(void): _node(NULL), _alloc(), _pool() {}
+
+        explicit node_handle(const allocator_type& alloc): _node(NULL), _alloc(alloc), _pool(NodeAlloc(alloc)) {}
+
+# if __cplusplus >= 201103L
+        node_handle(node_handle&& x): _node(NULL), _alloc(x._alloc), _pool(NodeAlloc(x._alloc))
+        {
+			this->swap(x);
+		}
+
+        node_handle& operator=(node_handle&& x)
+        {
+			this->reset();
+			this->swap(x);
+			return (*this);
+		}
+
+		explicit operator bool(void) const
+        {
+			return (this->_node != NULL);
+		}
+# else
+        node_handle(const node_handle& x): _node(NULL), _alloc(x._alloc), _pool(NodeAlloc(x._alloc))
+        {
+			this->swap(const_cast<node_handle&>(x));
+		}
+
+        node_handle& operator=(const node_handle& x)
+        {
+			if (this != &x)
+            {
+				this->reset();
+				this->swap(const_cast<node_handle&>(x));
+            }
+			return (*this);
+		}
+# endif
+
+        ~node_handle(void)
+        {
+			this->reset();
+		}
+
+        bool empty(void) const
+        {
+			return (this->_node == NULL);
+		}
+
+        key_type& key(void) const
+        {
+			return (this->_node->pair._first);
+		}
+
+        mapped_type& mapped(void) const
+        {
+			return (this->_node->pair._second);
+		}
+
+        allocator_type get_allocator(void) const
+        {
+			return (this->_alloc);
+		}
+
+        void swap(node_handle& x)
+        {
+			std::swap(this->_node, x._node);
+			std::swap(this->_alloc, x._alloc);
+			this->_pool.swap(x._pool);
+		}
+
+    private:
+        /*
+        * the slot goes back through this handle's pool, with the rest of
+        * the storage it refers to
+        */
+        void reset(void)
+        {
+			NodeAlloc	alloc(this->_alloc);
+
+			if (this->_node == NULL)
+            {
+				return ;
+            }
+			alloc.destroy(this->_node);
+			this->_pool.deallocate(this->_node);
+			this->_node = NULL;
+		}
+    };
+
+    template <class Key, class T, class Node, class NodeAlloc, class Alloc>
+	void swap(ft::node_handle<Key, T, Node, NodeAlloc, Alloc>& lhs, ft::node_handle<Key, T, Node, NodeAlloc, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,347 @@
+#ifndef NODE_POOL_HPP
+# define NODE_POOL_HPP
+
+# include <memory>
+# include <cstddef>
+# include <algorithm>
+# if __cplusplus >= 201103L
+#  include <atomic>
+# endif
+
+/*
+* fixed-size object pool used by the trees for their nodes
+* storage is carved out of slabs obtained from Alloc, released nodes are kept
+* on an intrusive free list and handed out again before the slab is touched
+* nothing is allocated before the first object, slabs then double in size
+* from a few hundred bytes (one slot for large objects) up to 64 KiB, so
+* small pools stay small
+* constructing / destroying the objects stays the caller's job
+* objects can move from one pool to another (adopt()): the slabs of the
+* source are then sealed into an arena, an immutable set of slabs kept alive
+* by a reference count, which the receiving pool holds a reference to
+* free lists, cursors and unsealed slabs stay private to each pool, only
+* the counts are shared (atomic from c++11 on), so pools that exchanged
+* objects can still be used from different threads
+* an arena is given back to Alloc when the last pool referring to it is
+* released, until then its unused slots are pinned
+*/
+
+namespace ft
+{
+    template <class T, class Alloc = std::allocator<T> >
+    class node_pool
+    {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef Alloc           allocator_type;
+        typedef std::size_t     size_type;
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock*  next;
+        };
+
+        /*
+        * the first slab of a sealed list is the arena: it carries the count
+        * and the arenas it keeps alive (slabs whose objects moved to the
+        * pool it was sealed from), dead links arenas being released
+        */
+        struct Slab
+        {
+            Slab*       next;
+            size_type   count;
+            Slab*       held[2];
+            Slab*       dead;
+# if __cplusplus >= 201103L
+            std::atomic<size_type>  refs;
+# else
+            size_type               refs;
+# endif
+        };
+
+        static const size_type  _minSlabBytes = 256;
+        static const size_type  _maxSlabBytes = 65536;
+        static const size_type  _minSlab = (sizeof(T) < _minSlabBytes) ? _minSlabBytes / sizeof(T) : 1;
+        static const size_type  _maxSlab = (sizeof(T) < _maxSlabBytes) ? _maxSlabBytes / sizeof(T) : 1;
+
+        allocator_type  _alloc;
+        Slab*           _slabs;
+        FreeBlock*      _free;
+        pointer         _cursor;
+        pointer         _end;
+        size_type       _freeCount;
+        size_type       _nextSlab;
+        Slab*           _arena;
+
+        node_pool(const node_pool& x);
+        node_pool& operator=(const node_pool& x);
+
+    public:
+        explicit node_pool(const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _slabs(NULL),
+            _free(NULL),
+            _cursor(NULL),
+            _end(NULL),
+            _freeCount(0),
+            _nextSlab(_minSlab),
+            _arena(NULL) {}
+
+        ~node_pool(void)
+        {
+            this->release();
+        }
+
+        pointer allocate(void)
+        {
+            pointer res;
+
+            if (this->_free != NULL)
+            {
+                res = reinterpret_cast<pointer>(this->_free);
+                this->_free = this->_free->next;
+                this->_freeCount--;
+                return (res);
+            }
+            if (this->_cursor == this->_end)
+            {
+                this->addSlab(this->_nextSlab);
+                this->_nextSlab = (this->_nextSlab < _maxSlab / 2) ? this->_nextSlab * 2 : _maxSlab;
+            }
+            return (this->_cursor++);
+        }
+
+        void deallocate(pointer p)
+        {
+            FreeBlock*  block = reinterpret_cast<FreeBlock*>(p);
+
+            block->next = this->_free;
+            this->_free = block;
+            this->_freeCount++;
+        }
+
+        /*
+        * makes sure the next n calls to allocate() won't go back to Alloc
+        */
+        void reserve(size_type n)
+        {
+            size_type   available = this->_freeCount + (this->_end - this->_cursor);
+
+            if (n <= available)
+            {
+                return ;
+            }
+            this->retireCursor();
+            this->addSlab(n - available);
+        }
+
+        /*
+        * bulk path: gives every slab back to Alloc at once, all the slots
+        * handed out so far become invalid
+        * an arena is only given back with the last reference to it, the
+        * objects other pools took from it stay valid
+        */
+        void release(void)
+        {
+            freeSlabs(this->_alloc, this->_slabs);
+            dropArena(this->_alloc, this->_arena);
+            this->_slabs = NULL;
+            this->_arena = NULL;
+            this->_free = NULL;
+            this->_cursor = NULL;
+            this->_end = NULL;
+            this->_freeCount = 0;
+            this->_nextSlab = _minSlab;
+        }
+
+        /*
+        * slabs change owner, slots handed out stay valid
+        */
+        void swap(node_pool& x)
+        {
+            std::swap(this->_alloc, x._alloc);
+            std::swap(this->_slabs, x._slabs);
+            std::swap(this->_free, x._free);
+            std::swap(this->_cursor, x._cursor);
+            std::swap(this->_end, x._end);
+            std::swap(this->_freeCount, x._freeCount);
+            std::swap(this->_nextSlab, x._nextSlab);
+            std::swap(this->_arena, x._arena);
+        }
+
+        /*
+        * objects of x may then move to this pool (and be released through
+        * it): x's slabs are sealed and this pool takes a reference on them
+        * this pool's own unsealed slabs, if any, are sealed along to hold
+        * that reference, otherwise a pool that already refers to another
+        * arena allocates a header-only one for it
+        */
+        void adopt(node_pool& x)
+        {
+            Slab*   arena;
+
+            if (this == &x)
+            {
+                return ;
+            }
+            x.seal(NULL);
+            arena = x._arena;
+            if (arena == NULL || this->holds(arena))
+            {
+                return ;
+            }
+            if (this->_slabs == NULL && this->_arena != NULL)
+            {
+                this->addSlab(0);
+            }
+            retain(arena);
+            if (this->_slabs == NULL)
+            {
+                this->_arena = arena;
+                return ;
+            }
+            this->seal(arena);
+        }
+
+        size_type max_size(void) const
+        {
+            return (this->_alloc.max_size());
+        }
+
+        allocator_type get_allocator(void) const
+        {
+            return (this->_alloc);
+        }
+
+    private:
+        /*
+        * the slab header lives in the first slots of the slab itself
+        */
+        void addSlab(size_type n)
+        {
+            size_type   header = (sizeof(Slab) + sizeof(value_type) - 1) / sizeof(value_type);
+            pointer     mem = this->_alloc.allocate(header + n);
+            Slab*       slab = reinterpret_cast<Slab*>(mem);
+
+            ::new (static_cast<void*>(slab)) Slab();
+            slab->next = this->_slabs;
+            slab->count = header + n;
+            this->_slabs = slab;
+            if (n != 0)
+            {
+                this->_cursor = mem + header;
+                this->_end = this->_cursor + n;
+            }
+        }
+
+        /*
+        * slots left in the current slab go to the free list so they are
+        * not lost when a new slab becomes current
+        */
+        void retireCursor(void)
+        {
+            while (this->_cursor != this->_end)
+            {
+                this->deallocate(this->_cursor++);
+            }
+        }
+
+        /*
+        * arenas
+        * the unsealed slabs become a new arena, holding the previous one
+        * and extra (already retained), the cursor and the free list keep
+        * pointing into them
+        */
+        void seal(Slab* extra)
+        {
+            Slab*   arena = this->_slabs;
+
+            if (arena == NULL)
+            {
+                return ;
+            }
+            arena->held[0] = this->_arena;
+            arena->held[1] = extra;
+            arena->refs = 1;
+            this->_arena = arena;
+            this->_slabs = NULL;
+        }
+
+        /*
+        * one level deep, enough to not stack arenas when objects keep
+        * moving between the same two pools
+        */
+        bool holds(Slab* arena) const
+        {
+            return (this->_arena == arena || (this->_arena != NULL
+                && (this->_arena->held[0] == arena || this->_arena->held[1] == arena)));
+        }
+
+        static void retain(Slab* arena)
+        {
+# if __cplusplus >= 201103L
+            arena->refs.fetch_add(1, std::memory_order_relaxed);
+# else
+            arena->refs++;
+# endif
+        }
+
+        /*
+        * true when the last reference is gone
+        */
+        static bool releaseRef(Slab* arena)
+        {
+# if __cplusplus >= 201103L
+            return (arena->refs.fetch_sub(1, std::memory_order_acq_rel) == 1);
+# else
+            return (--arena->refs == 0);
+# endif
+        }
+
+        static void freeSlabs(allocator_type& alloc, Slab* slabs)
+        {
+            Slab*   next;
+
+            while (slabs != NULL)
+            {
+                next = slabs->next;
+                alloc.deallocate(reinterpret_cast<pointer>(slabs), slabs->count);
+                slabs = next;
+            }
+        }
+
+        /*
+        * arenas form a dag (an arena only holds older ones), released
+        * iteratively through the dead links
+        */
+        static void dropArena(allocator_type& alloc, Slab* arena)
+        {
+            Slab*   dead = NULL;
+
+            if (arena == NULL || !releaseRef(arena))
+            {
+                return ;
+            }
+            arena->dead = NULL;
+            dead = arena;
+            while (dead != NULL)
+            {
+                arena = dead;
+                dead = arena->dead;
+                for (int i = 0; i < 2; i++)
+                {
+                    if (arena->held[i] != NULL && releaseRef(arena->held[i]))
+                    {
+                        arena->held[i]->dead = dead;
+                        dead = arena->held[i];
+                    }
+                }
+                freeSlabs(alloc, arena);
+            }
+        }
+    };
+}
+
+#endif
\ No newline at end of file
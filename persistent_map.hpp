@@ -0,0 +1,294 @@
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <functional>
+# include <stdexcept>
+# include <algorithm>
+# include "pair.hpp"
+# include "reverse_iterator.hpp"
+# include "binary_search_tree.hpp"
+# include "equal.hpp"
+# include "enable_if.hpp"
+# include "is_integral.hpp"
+
+/*
+* ordered map over the persistent red-black tree of binary_search_tree.hpp
+* copies are O(1) and share every node, an update copies only the nodes on
+* its path: snapshot() hands out a frozen version that can be walked (from
+* another thread in c++11) while this map keeps changing
+* elements are only changed through the map (iterators are read only),
+* references returned by operator[] are invalidated by the next copy
+* iterators stay valid as long as the version they come from is not
+* updated nor destroyed
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class persistent_map
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+		typedef Compare					key_compare;
+		typedef Alloc					allocator_type;
+
+		typedef value_type&						reference;
+		typedef const value_type&				const_reference;
+		typedef typename Alloc::pointer			pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+
+		typedef typename Alloc::template rebind<ft::PersistentNode<Key, T> >::other	node_allocator_type;
+		typedef ft::PersistentBST<Key, T, Compare, node_allocator_type>				tree_type;
+
+		typedef typename tree_type::const_iterator			iterator;
+		typedef typename tree_type::const_iterator			const_iterator;
+		typedef typename tree_type::const_reverse_iterator	reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator	const_reverse_iterator;
+
+    private:
+        typedef typename tree_type::NodePtr	node_pointer;
+
+        allocator_type	_alloc;
+        key_compare		_compare;
+        tree_type		_tree;
+
+    public:
+        explicit persistent_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _compare(comp),
+			_tree(comp, alloc) {}
+
+        template <class InputIterator>
+		persistent_map(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last,
+			const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _compare(comp),
+			_tree(comp, alloc)
+        {
+			this->insert(first, last);
+		}
+
+		/*
+		* O(1), see snapshot()
+		*/
+        persistent_map(const persistent_map& x): _alloc(x._alloc), _compare(x._compare), _tree(x._tree) {}
+
+		persistent_map& operator=(const persistent_map& x)
+        {
+			this->_tree = x._tree;
+			this->_compare = x._compare;
+		    return (*this);
+		}
+
+        ~persistent_map(void) {}
+
+		/*
+		* the current version, in O(1): later updates of either map copy
+		* the nodes they touch and never show through the other one
+		*/
+		persistent_map snapshot(void) const
+        {
+			return (*this);
+		}
+
+        const_iterator begin(void) const
+        {
+			return (this->_tree.begin());
+		}
+
+		const_iterator end(void) const
+        {
+			return (this->_tree.end());
+		}
+
+		const_reverse_iterator rbegin(void) const
+        {
+			return (const_reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rend(void) const
+        {
+			return (const_reverse_iterator(this->begin()));
+		}
+
+        bool empty(void) const
+        {
+			return (this->_tree.getSize() == 0);
+		}
+
+		size_type size(void) const
+        {
+			return (this->_tree.getSize());
+		}
+
+		size_type max_size(void) const
+        {
+			return (node_allocator_type(this->_alloc).max_size());
+		}
+
+        mapped_type& operator[](const key_type& k)
+        {
+			node_pointer	node = this->_tree.ownNode(k);
+
+			if (node == NULL)
+            {
+				node = this->_tree.insertNode(ft::make_pair(k, mapped_type()))._first;
+            }
+			return (node->pair._second);
+		}
+
+		const mapped_type& at(const key_type& k) const
+        {
+			node_pointer	node = this->_tree.searchNode(k);
+
+			if (node == NULL)
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (node->pair._second);
+		}
+
+        ft::pair<const_iterator, bool> insert(const value_type& val)
+        {
+			ft::pair<node_pointer, bool>	res = this->_tree.insertNode(val);
+
+			return (ft::make_pair(this->_tree.position(res._first), res._second));
+		}
+
+		const_iterator insert(const_iterator position, const value_type& val)
+        {
+			(void)position;
+			return (this->insert(val)._first);
+		}
+
+        template <class InputIterator>
+		void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+        {
+			while (first != last)
+            {
+				this->_tree.insertNode(*first);
+				first++;
+			}
+		}
+
+		ft::pair<const_iterator, bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+        {
+			node_pointer	node = this->_tree.ownNode(k);
+
+			if (node != NULL)
+            {
+				node->pair._second = obj;
+				return (ft::make_pair(this->_tree.position(node), false));
+            }
+			return (this->insert(value_type(k, obj)));
+		}
+
+        void erase(const_iterator position)
+        {
+			this->_tree.deleteNode(position->_first);
+		}
+
+        size_type erase(const key_type& k)
+        {
+			return (this->_tree.deleteNode(k) ? 1 : 0);
+		}
+
+		/*
+		* the keys of [first, last) are in another version once the first
+		* one is erased, they are read from a copy taken beforehand
+		*/
+        void erase(const_iterator first, const_iterator last)
+        {
+			persistent_map	keep(*this);
+
+			(void)keep;
+			while (first != last)
+            {
+				this->_tree.deleteNode((first++)->_first);
+            }
+		}
+
+        void swap(persistent_map& x)
+        {
+			this->_tree.swap(x._tree);
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_compare, x._compare);
+		}
+
+        void clear(void)
+        {
+			this->_tree.clearTree();
+		}
+
+        key_compare key_comp(void) const
+        {
+			return (this->_compare);
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			return (this->_tree.find(k));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			return (this->_tree.searchNode(k) == NULL ? 0 : 1);
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+        {
+			return (this->_tree.lowerBound(k));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+        {
+			return (this->_tree.upperBound(k));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+        allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+		/*
+		* versions sharing their root are equal without looking further
+		*/
+		bool sameVersion(const persistent_map& x) const
+        {
+			return (this->_tree.getRoot() == x._tree.getRoot());
+		}
+    };
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator==(const ft::persistent_map<Key, T, Compare, Alloc>& lhs, const ft::persistent_map<Key, T, Compare, Alloc>& rhs)
+    {
+		if (lhs.size() != rhs.size())
+        {
+			return (false);
+        }
+		return (lhs.sameVersion(rhs) || ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!=(const ft::persistent_map<Key, T, Compare, Alloc>& lhs, const ft::persistent_map<Key, T, Compare, Alloc>& rhs)
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(ft::persistent_map<Key, T, Compare, Alloc>& lhs, ft::persistent_map<Key, T, Compare, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
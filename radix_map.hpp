@@ -0,0 +1,1421 @@
+#ifndef RADIX_MAP_HPP
+# define RADIX_MAP_HPP
+
+# include <string>
+# include <stdexcept>
+# include <memory>
+# include <cstddef>
+# include <algorithm>
+# include "pair.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "equal.hpp"
+# include "node_pool.hpp"
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+
+/*
+* ordered map on std::string keys stored as an adaptive radix tree
+* an inner node branches on one byte of the key and comes in four sizes
+* (up to 4, 16, 48 or 256 children) so it only takes the room its fanout
+* needs, it grows and shrinks as children come and go
+* the bytes every key under a node shares are kept on the node (path
+* compression): the first _maxPrefix of them inline, the rest are read from
+* any leaf below when they are needed
+* a key that ends on a node (a prefix of longer keys) hangs off the node's
+* end slot, it sorts before all the children
+* bytes compare as unsigned char, the order of std::string::compare
+* leaves are also chained in key order, iterators walk that list and stay
+* valid until their element is erased, the way map's do
+*/
+
+namespace ft
+{
+    template <class T, class Alloc = std::allocator<ft::pair<const std::string, T> > >
+    class radix_map
+    {
+    public:
+        typedef std::string							key_type;
+		typedef T									mapped_type;
+		typedef ft::pair<const std::string, T>		value_type;
+		typedef std::size_t							size_type;
+		typedef std::ptrdiff_t						difference_type;
+		typedef Alloc								allocator_type;
+
+		typedef value_type&							reference;
+		typedef const value_type&					const_reference;
+		typedef typename Alloc::pointer				pointer;
+		typedef typename Alloc::const_pointer		const_pointer;
+
+    private:
+        struct Link
+        {
+            Link*	prev;
+            Link*	next;
+        };
+
+        struct Leaf: public Link
+        {
+            value_type	pair;
+
+            explicit Leaf(const value_type& val): Link(), pair(val) {}
+        };
+
+    public:
+		/*
+		* walks the leaf list, the map's own link is end()
+		*/
+		template <class U>
+		class RadixIterator
+        {
+        public:
+			typedef U								value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef U*								pointer;
+			typedef U&								reference;
+			typedef ft::bidirectional_iterator_tag	iterator_category;
+
+        private:
+			Link*	_link;
+
+        public:
+			RadixIterator(void): _link(NULL) {}
+
+			explicit RadixIterator(Link* link): _link(link) {}
+
+			template <class V>
+			RadixIterator(const RadixIterator<V>& x): _link(x.getLink()) {}
+
+			Link* getLink(void) const
+            {
+				return (this->_link);
+			}
+
+			reference operator*(void) const
+            {
+				return (static_cast<Leaf*>(this->_link)->pair);
+			}
+
+			pointer operator->(void) const
+            {
+				return (&static_cast<Leaf*>(this->_link)->pair);
+			}
+
+			RadixIterator& operator++(void)
+            {
+				this->_link = this->_link->next;
+				return (*this);
+			}
+
+			RadixIterator operator++(int)
+            {
+				RadixIterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			RadixIterator& operator--(void)
+            {
+				this->_link = this->_link->prev;
+				return (*this);
+			}
+
+			RadixIterator operator--(int)
+            {
+				RadixIterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			template <class V>
+			bool operator==(const RadixIterator<V>& rhs) const
+            {
+				return (this->_link == rhs.getLink());
+			}
+
+			template <class V>
+			bool operator!=(const RadixIterator<V>& rhs) const
+            {
+				return (this->_link != rhs.getLink());
+			}
+        };
+
+		typedef RadixIterator<value_type>				iterator;
+		typedef RadixIterator<const value_type>			const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+    private:
+        enum { NODE4, NODE16, NODE48, NODE256 };
+
+        static const size_type	_maxPrefix = 13;
+
+        /*
+        * a child is either an inner node or a leaf with the low bit set
+        */
+        struct Inner
+        {
+            size_type		prefixLen;
+            Leaf*			end;
+            unsigned short	count;
+            unsigned char	type;
+            unsigned char	prefix[_maxPrefix];
+
+            explicit Inner(unsigned char t): prefixLen(0), end(NULL), count(0), type(t) {}
+        };
+
+        /*
+        * 4 and 16 keep their bytes sorted, 48 maps a byte to a slot + 1
+        * (0 is no child), 256 indexes its children by the byte
+        */
+        struct Node4: public Inner
+        {
+            unsigned char	keys[4];
+            Inner*			children[4];
+
+            Node4(void): Inner(NODE4) {}
+        };
+
+        struct Node16: public Inner
+        {
+            unsigned char	keys[16];
+            Inner*			children[16];
+
+            Node16(void): Inner(NODE16) {}
+        };
+
+        struct Node48: public Inner
+        {
+            unsigned char	index[256];
+            Inner*			children[48];
+
+            Node48(void): Inner(NODE48)
+            {
+                std::fill(this->index, this->index + 256, 0);
+            }
+        };
+
+        struct Node256: public Inner
+        {
+            Inner*	children[256];
+
+            Node256(void): Inner(NODE256)
+            {
+                std::fill(this->children, this->children + 256, static_cast<Inner*>(NULL));
+            }
+        };
+
+        typedef typename Alloc::template rebind<Leaf>::other	leaf_allocator_type;
+        typedef typename Alloc::template rebind<Node4>::other	node4_allocator_type;
+        typedef typename Alloc::template rebind<Node16>::other	node16_allocator_type;
+        typedef typename Alloc::template rebind<Node48>::other	node48_allocator_type;
+        typedef typename Alloc::template rebind<Node256>::other	node256_allocator_type;
+
+        allocator_type										_alloc;
+        ft::node_pool<Leaf, leaf_allocator_type>			_leaves;
+        ft::node_pool<Node4, node4_allocator_type>			_pool4;
+        ft::node_pool<Node16, node16_allocator_type>		_pool16;
+        ft::node_pool<Node48, node48_allocator_type>		_pool48;
+        ft::node_pool<Node256, node256_allocator_type>		_pool256;
+        Inner*												_root;
+        Link												_head;
+        size_type											_size;
+
+    public:
+        explicit radix_map(const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _leaves(leaf_allocator_type(alloc)),
+            _pool4(node4_allocator_type(alloc)),
+            _pool16(node16_allocator_type(alloc)),
+            _pool48(node48_allocator_type(alloc)),
+            _pool256(node256_allocator_type(alloc)),
+            _root(NULL),
+            _size(0)
+        {
+			this->_head.prev = &this->_head;
+			this->_head.next = &this->_head;
+		}
+
+        template <class InputIterator>
+        radix_map(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+            _leaves(leaf_allocator_type(alloc)),
+            _pool4(node4_allocator_type(alloc)),
+            _pool16(node16_allocator_type(alloc)),
+            _pool48(node48_allocator_type(alloc)),
+            _pool256(node256_allocator_type(alloc)),
+            _root(NULL),
+            _size(0)
+        {
+			this->_head.prev = &this->_head;
+			this->_head.next = &this->_head;
+			this->insert(first, last);
+		}
+
+        /*
+        * the elements come in order, each one goes at the end of the list
+        * without looking for its neighbours
+        */
+        radix_map(const radix_map& x):
+            _alloc(x._alloc),
+            _leaves(leaf_allocator_type(x._alloc)),
+            _pool4(node4_allocator_type(x._alloc)),
+            _pool16(node16_allocator_type(x._alloc)),
+            _pool48(node48_allocator_type(x._alloc)),
+            _pool256(node256_allocator_type(x._alloc)),
+            _root(NULL),
+            _size(0)
+        {
+			const_iterator	it;
+
+			this->_head.prev = &this->_head;
+			this->_head.next = &this->_head;
+			for (it = x.begin(); it != x.end(); ++it)
+            {
+				this->insertLeaf(this->makeLeaf(*it), &this->_head);
+            }
+		}
+
+		radix_map& operator=(const radix_map& x)
+        {
+			radix_map	tmp(x);
+
+			this->swap(tmp);
+			return (*this);
+		}
+
+        ~radix_map(void)
+        {
+			this->clear();
+		}
+
+        iterator begin(void)
+        {
+			return (iterator(this->_head.next));
+		}
+
+		const_iterator begin(void) const
+        {
+			return (const_iterator(this->_head.next));
+		}
+
+		iterator end(void)
+        {
+			return (iterator(&this->_head));
+		}
+
+		const_iterator end(void) const
+        {
+			return (const_iterator(const_cast<Link*>(&this->_head)));
+		}
+
+		reverse_iterator rbegin(void)
+        {
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin(void) const
+        {
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend(void)
+        {
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend(void) const
+        {
+			return (const_reverse_iterator(this->begin()));
+		}
+
+        bool empty(void) const
+        {
+			return (this->_size == 0);
+		}
+
+		size_type size(void) const
+        {
+			return (this->_size);
+		}
+
+		size_type max_size(void) const
+        {
+			return (this->_leaves.max_size());
+		}
+
+		mapped_type& operator[](const key_type& k)
+        {
+			return ((*(this->insert(ft::make_pair(k, mapped_type()))._first))._second);
+		}
+
+		mapped_type& at(const key_type& k)
+        {
+			iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+		const mapped_type& at(const key_type& k) const
+        {
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+        /*
+        * the new leaf goes in the list before the first key above it
+        */
+		ft::pair<iterator, bool> insert(const value_type& val)
+        {
+			Link*	next = this->lowerBoundLink(val._first);
+
+			if (next != &this->_head && static_cast<Leaf*>(next)->pair._first == val._first)
+            {
+				return (ft::make_pair(iterator(next), false));
+            }
+			return (ft::make_pair(iterator(this->insertLeaf(this->makeLeaf(val), next)), true));
+		}
+
+		iterator insert(iterator position, const value_type& val)
+        {
+			(void)position;
+			return (this->insert(val)._first);
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+        {
+			while (first != last)
+            {
+				this->insert(*first);
+				++first;
+            }
+		}
+
+		void erase(iterator position)
+        {
+			Leaf*	leaf = static_cast<Leaf*>(position.getLink());
+
+			this->eraseLeaf(leaf->pair._first);
+			this->destroyLeaf(leaf);
+		}
+
+		size_type erase(const key_type& k)
+        {
+			Leaf*	leaf = this->eraseLeaf(k);
+
+			if (leaf == NULL)
+            {
+				return (0);
+            }
+			this->destroyLeaf(leaf);
+			return (1);
+		}
+
+		void erase(iterator first, iterator last)
+        {
+			while (first != last)
+            {
+				this->erase(first++);
+            }
+		}
+
+        void swap(radix_map& x)
+        {
+			Link*	next = this->_head.next;
+			Link*	prev = this->_head.prev;
+
+			std::swap(this->_alloc, x._alloc);
+			this->_leaves.swap(x._leaves);
+			this->_pool4.swap(x._pool4);
+			this->_pool16.swap(x._pool16);
+			this->_pool48.swap(x._pool48);
+			this->_pool256.swap(x._pool256);
+			std::swap(this->_root, x._root);
+			std::swap(this->_size, x._size);
+			this->adoptList(this->_head, x._head.next, x._head.prev, &x._head);
+			this->adoptList(x._head, next, prev, &this->_head);
+		}
+
+		/*
+		* bulk path: the leaves are destroyed in list order, the inner
+		* nodes hold nothing to destroy and go back with their slabs
+		*/
+		void clear(void)
+        {
+			Link*	link = this->_head.next;
+			Link*	next;
+
+			while (link != &this->_head)
+            {
+				next = link->next;
+				this->_leaves.get_allocator().destroy(static_cast<Leaf*>(link));
+				link = next;
+            }
+			this->_leaves.release();
+			this->_pool4.release();
+			this->_pool16.release();
+			this->_pool48.release();
+			this->_pool256.release();
+			this->_root = NULL;
+			this->_head.prev = &this->_head;
+			this->_head.next = &this->_head;
+			this->_size = 0;
+		}
+
+		iterator find(const key_type& k)
+        {
+			return (iterator(this->findLink(k)));
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			return (const_iterator(this->findLink(k)));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			return ((this->findLink(k) != &this->_head) ? 1 : 0);
+		}
+
+		iterator lower_bound(const key_type& k)
+        {
+			return (iterator(this->lowerBoundLink(k)));
+		}
+
+		const_iterator lower_bound(const key_type& k) const
+        {
+			return (const_iterator(this->lowerBoundLink(k)));
+		}
+
+		iterator upper_bound(const key_type& k)
+        {
+			return (iterator(this->upperBoundLink(k)));
+		}
+
+		const_iterator upper_bound(const key_type& k) const
+        {
+			return (const_iterator(this->upperBoundLink(k)));
+		}
+
+		ft::pair<iterator, iterator> equal_range(const key_type& k)
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		}
+
+        allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+    private:
+		static bool isLeaf(const Inner* ref)
+        {
+			return ((reinterpret_cast<std::size_t>(ref) & 1) != 0);
+		}
+
+		static Leaf* leafOf(const Inner* ref)
+        {
+			return (reinterpret_cast<Leaf*>(reinterpret_cast<std::size_t>(ref) & ~static_cast<std::size_t>(1)));
+		}
+
+		static Inner* refOf(Leaf* leaf)
+        {
+			return (reinterpret_cast<Inner*>(reinterpret_cast<std::size_t>(leaf) | 1));
+		}
+
+		static unsigned char byteAt(const key_type& k, size_type i)
+        {
+			return (static_cast<unsigned char>(k[i]));
+		}
+
+		/*
+		* lookups
+		* the inline prefix bytes are checked on the way down and the rest
+		* skipped, the leaf found compares the whole key anyway
+		*/
+		Link* findLink(const key_type& k) const
+        {
+			const Inner*	ref = this->_root;
+			Inner* const*	child;
+			Leaf*			leaf = NULL;
+			size_type		depth = 0;
+
+			while (ref != NULL && !isLeaf(ref))
+            {
+				if (!prefixMatches(ref, k, depth))
+                {
+					return (const_cast<Link*>(&this->_head));
+                }
+				depth += ref->prefixLen;
+				if (depth == k.size())
+                {
+					leaf = ref->end;
+					break ;
+                }
+				child = findChild(ref, byteAt(k, depth));
+				ref = (child != NULL) ? *child : NULL;
+				depth++;
+            }
+			if (ref != NULL && isLeaf(ref))
+            {
+				leaf = leafOf(ref);
+            }
+			if (leaf == NULL || leaf->pair._first != k)
+            {
+				return (const_cast<Link*>(&this->_head));
+            }
+			return (leaf);
+		}
+
+		Link* lowerBoundLink(const key_type& k) const
+        {
+			Leaf*	leaf = lowerBoundLeaf(this->_root, k, 0);
+
+			return ((leaf != NULL) ? static_cast<Link*>(leaf) : const_cast<Link*>(&this->_head));
+		}
+
+		Link* upperBoundLink(const key_type& k) const
+        {
+			Link*	link = this->lowerBoundLink(k);
+
+			if (link != &this->_head && static_cast<Leaf*>(link)->pair._first == k)
+            {
+				return (link->next);
+            }
+			return (link);
+		}
+
+		/*
+		* smallest leaf of the subtree not below k, the prefix has to be
+		* compared in full here: a subtree is either all below k, all above
+		* or decided by its children
+		*/
+		static Leaf* lowerBoundLeaf(const Inner* ref, const key_type& k, size_type depth)
+        {
+			const key_type*	full = NULL;
+			Inner* const*	child;
+			const Inner*	next;
+			Leaf*			res;
+			unsigned char	byte;
+			size_type		i;
+
+			if (ref == NULL)
+            {
+				return (NULL);
+            }
+			if (isLeaf(ref))
+            {
+				res = leafOf(ref);
+				return ((res->pair._first.compare(k) >= 0) ? res : NULL);
+            }
+			for (i = 0; i < ref->prefixLen; i++)
+            {
+				if (depth + i == k.size())
+                {
+					return (minLeaf(ref));
+                }
+				if (i < _maxPrefix)
+                {
+					byte = ref->prefix[i];
+                }
+				else
+                {
+					if (full == NULL)
+                    {
+						full = &minLeaf(ref)->pair._first;
+                    }
+					byte = byteAt(*full, depth + i);
+                }
+				if (byteAt(k, depth + i) != byte)
+                {
+					return ((byteAt(k, depth + i) < byte) ? minLeaf(ref) : NULL);
+                }
+            }
+			depth += ref->prefixLen;
+			if (depth == k.size())
+            {
+				return (minLeaf(ref));
+            }
+			byte = byteAt(k, depth);
+			child = findChild(ref, byte);
+			if (child != NULL && (res = lowerBoundLeaf(*child, k, depth + 1)) != NULL)
+            {
+				return (res);
+            }
+			next = nextChild(ref, byte);
+			return ((next != NULL) ? minLeaf(next) : NULL);
+		}
+
+		static bool prefixMatches(const Inner* node, const key_type& k, size_type depth)
+        {
+			size_type	n = node->prefixLen;
+			size_type	i;
+
+			if (n > _maxPrefix)
+            {
+				n = _maxPrefix;
+            }
+
+			if (depth + node->prefixLen > k.size())
+            {
+				return (false);
+            }
+			for (i = 0; i < n; i++)
+            {
+				if (node->prefix[i] != byteAt(k, depth + i))
+                {
+					return (false);
+                }
+            }
+			return (true);
+		}
+
+		/*
+		* length of the prefix k shares with the node, reading the bytes past
+		* the inline ones from a leaf below
+		*/
+		static size_type prefixMismatch(const Inner* node, const key_type& k, size_type depth)
+        {
+			const key_type*	full = NULL;
+			unsigned char	byte;
+			size_type		i;
+
+			for (i = 0; i < node->prefixLen; i++)
+            {
+				if (depth + i == k.size())
+                {
+					return (i);
+                }
+				if (i < _maxPrefix)
+                {
+					byte = node->prefix[i];
+                }
+				else
+                {
+					if (full == NULL)
+                    {
+						full = &minLeaf(node)->pair._first;
+                    }
+					byte = byteAt(*full, depth + i);
+                }
+				if (byteAt(k, depth + i) != byte)
+                {
+					return (i);
+                }
+            }
+			return (i);
+		}
+
+		static void setPrefix(Inner* node, const key_type& k, size_type from)
+        {
+			size_type	n = node->prefixLen;
+			size_type	i;
+
+			if (n > _maxPrefix)
+            {
+				n = _maxPrefix;
+            }
+
+			for (i = 0; i < n; i++)
+            {
+				node->prefix[i] = byteAt(k, from + i);
+            }
+		}
+
+		static Leaf* minLeaf(const Inner* ref)
+        {
+			while (!isLeaf(ref))
+            {
+				if (ref->end != NULL)
+                {
+					return (ref->end);
+                }
+				ref = firstChild(ref);
+            }
+			return (leafOf(ref));
+		}
+
+		/*
+		* children
+		*/
+		static Inner* const* findChild(const Inner* node, unsigned char byte)
+        {
+			return (findChild(const_cast<Inner*>(node), byte));
+		}
+
+		static Inner** findChild(Inner* node, unsigned char byte)
+        {
+			Node4*		n4;
+			Node16*		n16;
+			Node48*		n48;
+			Node256*	n256;
+			size_type	i;
+
+			switch (node->type)
+            {
+				case NODE4:
+					n4 = static_cast<Node4*>(node);
+					for (i = 0; i < n4->count; i++)
+                    {
+						if (n4->keys[i] == byte)
+                        {
+							return (&n4->children[i]);
+                        }
+                    }
+					return (NULL);
+				case NODE16:
+					n16 = static_cast<Node16*>(node);
+# if defined(__SSE2__)
+                    {
+						unsigned	match = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+							_mm_loadu_si128(reinterpret_cast<const __m128i*>(n16->keys)))));
+
+						match &= (1u << n16->count) - 1;
+						return ((match != 0) ? &n16->children[lowestBit(match)] : NULL);
+                    }
+# else
+					for (i = 0; i < n16->count; i++)
+                    {
+						if (n16->keys[i] == byte)
+                        {
+							return (&n16->children[i]);
+                        }
+                    }
+					return (NULL);
+# endif
+				case NODE48:
+					n48 = static_cast<Node48*>(node);
+					return ((n48->index[byte] != 0) ? &n48->children[n48->index[byte] - 1] : NULL);
+				default:
+					n256 = static_cast<Node256*>(node);
+					return ((n256->children[byte] != NULL) ? &n256->children[byte] : NULL);
+            }
+		}
+
+		static size_type lowestBit(unsigned mask)
+        {
+# if defined(__GNUC__)
+			return (static_cast<size_type>(__builtin_ctz(mask)));
+# else
+			size_type	i = 0;
+
+			while (!(mask & 1))
+            {
+				mask >>= 1;
+				i++;
+            }
+			return (i);
+# endif
+		}
+
+		static const Inner* firstChild(const Inner* node)
+        {
+			const Node48*	n48;
+			const Node256*	n256;
+			size_type		b;
+
+			switch (node->type)
+            {
+				case NODE4:
+					return (static_cast<const Node4*>(node)->children[0]);
+				case NODE16:
+					return (static_cast<const Node16*>(node)->children[0]);
+				case NODE48:
+					n48 = static_cast<const Node48*>(node);
+					for (b = 0; n48->index[b] == 0; b++) ;
+					return (n48->children[n48->index[b] - 1]);
+				default:
+					n256 = static_cast<const Node256*>(node);
+					for (b = 0; n256->children[b] == NULL; b++) ;
+					return (n256->children[b]);
+            }
+		}
+
+		/*
+		* first child on a byte above byte, NULL if there is none
+		*/
+		static const Inner* nextChild(const Inner* node, unsigned char byte)
+        {
+			const Node4*	n4;
+			const Node16*	n16;
+			const Node48*	n48;
+			const Node256*	n256;
+			size_type		i;
+
+			switch (node->type)
+            {
+				case NODE4:
+					n4 = static_cast<const Node4*>(node);
+					for (i = 0; i < n4->count; i++)
+                    {
+						if (n4->keys[i] > byte)
+                        {
+							return (n4->children[i]);
+                        }
+                    }
+					return (NULL);
+				case NODE16:
+					n16 = static_cast<const Node16*>(node);
+					for (i = 0; i < n16->count; i++)
+                    {
+						if (n16->keys[i] > byte)
+                        {
+							return (n16->children[i]);
+                        }
+                    }
+					return (NULL);
+				case NODE48:
+					n48 = static_cast<const Node48*>(node);
+					for (i = byte + 1; i < 256; i++)
+                    {
+						if (n48->index[i] != 0)
+                        {
+							return (n48->children[n48->index[i] - 1]);
+                        }
+                    }
+					return (NULL);
+				default:
+					n256 = static_cast<const Node256*>(node);
+					for (i = byte + 1; i < 256; i++)
+                    {
+						if (n256->children[i] != NULL)
+                        {
+							return (n256->children[i]);
+                        }
+                    }
+					return (NULL);
+            }
+		}
+
+		/*
+		* *slot is replaced by a wider node when the node is full
+		*/
+		void addChild(Inner** slot, unsigned char byte, Inner* child)
+        {
+			Inner*	node = *slot;
+
+			if ((node->type == NODE4 && node->count == 4) || (node->type == NODE16 && node->count == 16)
+				|| (node->type == NODE48 && node->count == 48))
+            {
+				node = this->grow(node);
+				*slot = node;
+            }
+			switch (node->type)
+            {
+				case NODE4:
+					insertSorted(static_cast<Node4*>(node)->keys, static_cast<Node4*>(node)->children, node->count, byte, child);
+					break ;
+				case NODE16:
+					insertSorted(static_cast<Node16*>(node)->keys, static_cast<Node16*>(node)->children, node->count, byte, child);
+					break ;
+				case NODE48:
+					static_cast<Node48*>(node)->children[node->count] = child;
+					static_cast<Node48*>(node)->index[byte] = static_cast<unsigned char>(node->count + 1);
+					break ;
+				default:
+					static_cast<Node256*>(node)->children[byte] = child;
+					break ;
+            }
+			node->count++;
+		}
+
+		static void insertSorted(unsigned char* keys, Inner** children, size_type count, unsigned char byte, Inner* child)
+        {
+			size_type	i = count;
+
+			while (i > 0 && keys[i - 1] > byte)
+            {
+				keys[i] = keys[i - 1];
+				children[i] = children[i - 1];
+				i--;
+            }
+			keys[i] = byte;
+			children[i] = child;
+		}
+
+		/*
+		* the node on depth loses its child on byte and gets narrower, or
+		* goes away once a single entry is left
+		*/
+		void removeChild(Inner** slot, unsigned char byte, size_type depth)
+        {
+			Inner*		node = *slot;
+			Node48*		n48;
+			size_type	i;
+			size_type	last;
+
+			switch (node->type)
+            {
+				case NODE4:
+					removeSorted(static_cast<Node4*>(node)->keys, static_cast<Node4*>(node)->children, node->count, byte);
+					break ;
+				case NODE16:
+					removeSorted(static_cast<Node16*>(node)->keys, static_cast<Node16*>(node)->children, node->count, byte);
+					break ;
+				case NODE48:
+					n48 = static_cast<Node48*>(node);
+					i = n48->index[byte] - 1;
+					last = n48->count - 1;
+					n48->index[byte] = 0;
+					if (i != last)
+                    {
+						n48->children[i] = n48->children[last];
+						for (byte = 0; n48->index[byte] != last + 1; byte++) ;
+						n48->index[byte] = static_cast<unsigned char>(i + 1);
+                    }
+					break ;
+				default:
+					static_cast<Node256*>(node)->children[byte] = NULL;
+					break ;
+            }
+			node->count--;
+			this->shrink(slot, depth);
+		}
+
+		static void removeSorted(unsigned char* keys, Inner** children, size_type count, unsigned char byte)
+        {
+			size_type	i = 0;
+
+			while (keys[i] != byte)
+            {
+				i++;
+            }
+			for (; i + 1 < count; i++)
+            {
+				keys[i] = keys[i + 1];
+				children[i] = children[i + 1];
+            }
+		}
+
+		/*
+		* a node left with one entry is replaced by it: the end leaf, the
+		* only leaf, or the only inner node, whose prefix then takes this
+		* node's prefix and branch byte in front of its own
+		* the narrower sizes leave some slack so a node does not flip back
+		* and forth on the boundary
+		*/
+		void shrink(Inner** slot, size_type depth)
+        {
+			Inner*	node = *slot;
+			Inner*	child;
+
+			if (node->count + (node->end != NULL) == 1)
+            {
+				if (node->count == 0)
+                {
+					*slot = refOf(node->end);
+                }
+				else
+                {
+					child = const_cast<Inner*>(firstChild(node));
+					if (!isLeaf(child))
+                    {
+						child->prefixLen += node->prefixLen + 1;
+						setPrefix(child, minLeaf(child)->pair._first, depth);
+                    }
+					*slot = child;
+                }
+				this->destroyNode(node);
+				return ;
+            }
+			if ((node->type == NODE16 && node->count <= 3) || (node->type == NODE48 && node->count <= 12)
+				|| (node->type == NODE256 && node->count <= 37))
+            {
+				*slot = this->narrow(node);
+            }
+		}
+
+		/*
+		* node sizes
+		*/
+		template <class N, class P>
+		N* makeNode(P& pool)
+        {
+			N*	node = pool.allocate();
+
+			pool.get_allocator().construct(node, N());
+			return (node);
+		}
+
+		static void copyHeader(Inner* to, const Inner* from)
+        {
+			to->prefixLen = from->prefixLen;
+			to->end = from->end;
+			to->count = from->count;
+			std::copy(from->prefix, from->prefix + _maxPrefix, to->prefix);
+		}
+
+		Inner* grow(Inner* node)
+        {
+			Node4*		n4;
+			Node16*		n16;
+			Node48*		n48;
+			Node256*	n256;
+			size_type	i;
+
+			switch (node->type)
+            {
+				case NODE4:
+					n4 = static_cast<Node4*>(node);
+					n16 = this->template makeNode<Node16>(this->_pool16);
+					copyHeader(n16, n4);
+					std::copy(n4->keys, n4->keys + n4->count, n16->keys);
+					std::copy(n4->children, n4->children + n4->count, n16->children);
+					this->destroyNode(n4);
+					return (n16);
+				case NODE16:
+					n16 = static_cast<Node16*>(node);
+					n48 = this->template makeNode<Node48>(this->_pool48);
+					copyHeader(n48, n16);
+					for (i = 0; i < n16->count; i++)
+                    {
+						n48->index[n16->keys[i]] = static_cast<unsigned char>(i + 1);
+						n48->children[i] = n16->children[i];
+                    }
+					this->destroyNode(n16);
+					return (n48);
+				default:
+					n48 = static_cast<Node48*>(node);
+					n256 = this->template makeNode<Node256>(this->_pool256);
+					copyHeader(n256, n48);
+					for (i = 0; i < 256; i++)
+                    {
+						if (n48->index[i] != 0)
+                        {
+							n256->children[i] = n48->children[n48->index[i] - 1];
+                        }
+                    }
+					this->destroyNode(n48);
+					return (n256);
+            }
+		}
+
+		Inner* narrow(Inner* node)
+        {
+			Node4*		n4;
+			Node16*		n16;
+			Node48*		n48;
+			Node256*	n256;
+			size_type	i;
+
+			switch (node->type)
+            {
+				case NODE16:
+					n16 = static_cast<Node16*>(node);
+					n4 = this->template makeNode<Node4>(this->_pool4);
+					copyHeader(n4, n16);
+					std::copy(n16->keys, n16->keys + n16->count, n4->keys);
+					std::copy(n16->children, n16->children + n16->count, n4->children);
+					this->destroyNode(n16);
+					return (n4);
+				case NODE48:
+					n48 = static_cast<Node48*>(node);
+					n16 = this->template makeNode<Node16>(this->_pool16);
+					copyHeader(n16, n48);
+					n16->count = 0;
+					for (i = 0; i < 256; i++)
+                    {
+						if (n48->index[i] != 0)
+                        {
+							n16->keys[n16->count] = static_cast<unsigned char>(i);
+							n16->children[n16->count++] = n48->children[n48->index[i] - 1];
+                        }
+                    }
+					this->destroyNode(n48);
+					return (n16);
+				default:
+					n256 = static_cast<Node256*>(node);
+					n48 = this->template makeNode<Node48>(this->_pool48);
+					copyHeader(n48, n256);
+					n48->count = 0;
+					for (i = 0; i < 256; i++)
+                    {
+						if (n256->children[i] != NULL)
+                        {
+							n48->children[n48->count++] = n256->children[i];
+							n48->index[i] = static_cast<unsigned char>(n48->count);
+                        }
+                    }
+					this->destroyNode(n256);
+					return (n48);
+            }
+		}
+
+		void destroyNode(Inner* node)
+        {
+			switch (node->type)
+            {
+				case NODE4:
+					this->_pool4.deallocate(static_cast<Node4*>(node));
+					break ;
+				case NODE16:
+					this->_pool16.deallocate(static_cast<Node16*>(node));
+					break ;
+				case NODE48:
+					this->_pool48.deallocate(static_cast<Node48*>(node));
+					break ;
+				default:
+					this->_pool256.deallocate(static_cast<Node256*>(node));
+					break ;
+            }
+		}
+
+		/*
+		* leaves
+		*/
+		Leaf* makeLeaf(const value_type& val)
+        {
+			Leaf*	leaf = this->_leaves.allocate();
+
+			this->_leaves.get_allocator().construct(leaf, Leaf(val));
+			return (leaf);
+		}
+
+		void destroyLeaf(Leaf* leaf)
+        {
+			leaf->prev->next = leaf->next;
+			leaf->next->prev = leaf->prev;
+			this->_leaves.get_allocator().destroy(leaf);
+			this->_leaves.deallocate(leaf);
+			this->_size--;
+		}
+
+		/*
+		* links a leaf whose key is not in the map yet before next and
+		* hangs it in the tree
+		*/
+		Leaf* insertLeaf(Leaf* leaf, Link* next)
+        {
+			leaf->next = next;
+			leaf->prev = next->prev;
+			next->prev->next = leaf;
+			next->prev = leaf;
+			this->insertRef(&this->_root, leaf);
+			this->_size++;
+			return (leaf);
+		}
+
+		void insertRef(Inner** slot, Leaf* leaf)
+        {
+			const key_type&	k = leaf->pair._first;
+			Inner*			node;
+			Inner**			child;
+			size_type		depth = 0;
+			size_type		p;
+
+			while (*slot != NULL && !isLeaf(*slot))
+            {
+				node = *slot;
+				p = prefixMismatch(node, k, depth);
+				if (p < node->prefixLen)
+                {
+					this->splitPrefix(slot, leaf, depth, p);
+					return ;
+                }
+				depth += node->prefixLen;
+				if (depth == k.size())
+                {
+					node->end = leaf;
+					return ;
+                }
+				child = findChild(node, byteAt(k, depth));
+				if (child == NULL)
+                {
+					this->addChild(slot, byteAt(k, depth), refOf(leaf));
+					return ;
+                }
+				slot = child;
+				depth++;
+            }
+			if (*slot == NULL)
+            {
+				*slot = refOf(leaf);
+				return ;
+            }
+			this->splitLeaf(slot, leaf, depth);
+		}
+
+		/*
+		* two leaves under a new node4 whose prefix is what their keys share
+		* past depth
+		*/
+		void splitLeaf(Inner** slot, Leaf* leaf, size_type depth)
+        {
+			Leaf*			other = leafOf(*slot);
+			const key_type&	a = other->pair._first;
+			const key_type&	k = leaf->pair._first;
+			Node4*			node = this->template makeNode<Node4>(this->_pool4);
+			size_type		i = depth;
+
+			while (i < a.size() && i < k.size() && a[i] == k[i])
+            {
+				i++;
+            }
+			node->prefixLen = i - depth;
+			setPrefix(node, k, depth);
+			attach(node, other, i);
+			attach(node, leaf, i);
+			*slot = node;
+		}
+
+		/*
+		* the prefix of *slot differs from the key at p: a new node4 takes the
+		* shared part, the old node keeps what follows its branch byte
+		*/
+		void splitPrefix(Inner** slot, Leaf* leaf, size_type depth, size_type p)
+        {
+			Inner*			node = *slot;
+			const key_type&	full = minLeaf(node)->pair._first;
+			Node4*			top = this->template makeNode<Node4>(this->_pool4);
+
+			top->prefixLen = p;
+			setPrefix(top, leaf->pair._first, depth);
+			top->keys[0] = byteAt(full, depth + p);
+			top->children[0] = node;
+			top->count = 1;
+			node->prefixLen -= p + 1;
+			setPrefix(node, full, depth + p + 1);
+			attach(top, leaf, depth + p);
+			*slot = top;
+		}
+
+		static void attach(Node4* node, Leaf* leaf, size_type depth)
+        {
+			const key_type&	k = leaf->pair._first;
+
+			if (k.size() == depth)
+            {
+				node->end = leaf;
+				return ;
+            }
+			insertSorted(node->keys, node->children, node->count, byteAt(k, depth), refOf(leaf));
+			node->count++;
+		}
+
+		/*
+		* takes the leaf of k out of the tree, the list and the element are
+		* left to the caller
+		*/
+		Leaf* eraseLeaf(const key_type& k)
+        {
+			Inner**		slot = &this->_root;
+			Inner*		node;
+			Inner**		child;
+			Leaf*		leaf;
+			size_type	depth = 0;
+			size_type	start;
+
+			if (*slot == NULL)
+            {
+				return (NULL);
+            }
+			if (isLeaf(*slot))
+            {
+				leaf = leafOf(*slot);
+				if (leaf->pair._first != k)
+                {
+					return (NULL);
+                }
+				*slot = NULL;
+				return (leaf);
+            }
+			for (;;)
+            {
+				node = *slot;
+				start = depth;
+				if (!prefixMatches(node, k, depth))
+                {
+					return (NULL);
+                }
+				depth += node->prefixLen;
+				if (depth == k.size())
+                {
+					leaf = node->end;
+					if (leaf == NULL || leaf->pair._first != k)
+                    {
+						return (NULL);
+                    }
+					node->end = NULL;
+					this->shrink(slot, start);
+					return (leaf);
+                }
+				child = findChild(node, byteAt(k, depth));
+				if (child == NULL)
+                {
+					return (NULL);
+                }
+				if (isLeaf(*child))
+                {
+					leaf = leafOf(*child);
+					if (leaf->pair._first != k)
+                    {
+						return (NULL);
+                    }
+					this->removeChild(slot, byteAt(k, depth), start);
+					return (leaf);
+                }
+				slot = child;
+				depth++;
+            }
+		}
+
+		/*
+		* head takes the list first .. last that hung off old
+		*/
+		static void adoptList(Link& head, Link* first, Link* last, Link* old)
+        {
+			if (first == old)
+            {
+				head.prev = &head;
+				head.next = &head;
+				return ;
+            }
+			head.next = first;
+			head.prev = last;
+			first->prev = &head;
+			last->next = &head;
+		}
+    };
+
+	template <class T, class Alloc>
+	bool operator==(const ft::radix_map<T, Alloc>& lhs, const ft::radix_map<T, Alloc>& rhs)
+    {
+		if (lhs.size() != rhs.size())
+        {
+			return (false);
+        }
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const ft::radix_map<T, Alloc>& lhs, const ft::radix_map<T, Alloc>& rhs)
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	void swap(ft::radix_map<T, Alloc>& lhs, ft::radix_map<T, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
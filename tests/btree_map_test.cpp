@@ -0,0 +1,169 @@
+#include <map>
+#include <vector>
+#include "../btree_map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    /*
+    * the smallest nodes possible so that a few thousand keys already make
+    * a deep tree with lots of splits, borrows and merges
+    */
+    typedef ft::btree_map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, 16>   SmallBTree;
+    typedef ft::btree_map<int, int>                                                                 BTree;
+    typedef std::map<int, int>                                                                      StdIntMap;
+
+    template <class Map>
+    typename Map::iterator advance(Map& m, unsigned n)
+    {
+        typename Map::iterator  it = m.begin();
+
+        for (; n > 0 && it != m.end(); n--)
+        {
+            ++it;
+        }
+        return (it);
+    }
+
+    template <class Map>
+    void btreeRun(unsigned keys, int steps)
+    {
+        Map                             m;
+        StdIntMap                       s;
+        typename Map::iterator          it;
+        typename Map::iterator          last;
+        StdIntMap::iterator             jt;
+        int                             k;
+        unsigned                        a;
+        unsigned                        b;
+
+        for (int i = 0; i < steps; i++)
+        {
+            k = static_cast<int>(random(keys));
+            switch (random(8))
+            {
+                case 0:
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 1:
+                    a = random(static_cast<unsigned>(s.size()) + 1);
+                    b = a + random(40);
+                    it = advance(m, a);
+                    last = advance(m, b);
+                    jt = s.begin();
+                    for (unsigned n = 0; n < a && jt != s.end(); n++)
+                    {
+                        ++jt;
+                    }
+                    while (jt != s.end() && a++ < b)
+                    {
+                        s.erase(jt++);
+                    }
+                    m.erase(it, last);
+                    break ;
+                case 2:
+                    it = (random(2) == 0) ? m.lower_bound(k) : advance(m, random(static_cast<unsigned>(s.size()) + 1));
+                    it = m.insert(it, ft::make_pair(k, i));
+                    s.insert(std::make_pair(k, i));
+                    CHECK(it != m.end() && it->_first == k && it->_second == s[k]);
+                    break ;
+                case 3:
+                    m.insert_or_assign(k, i);
+                    s[k] = i;
+                    break ;
+                default:
+                    m[k] += i;
+                    s[k] += i;
+                    break ;
+            }
+            CHECK(m.size() == s.size());
+            k = static_cast<int>(random(keys + 2)) - 1;
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            CHECK((m.upper_bound(k) == m.end()) || m.upper_bound(k)->_first == s.upper_bound(k)->first);
+            if (i % 499 == 0)
+            {
+                CHECK(sameMap(m, s));
+            }
+        }
+        CHECK(sameMap(m, s));
+        m.erase(m.begin(), m.end());
+        CHECK(m.empty() && m.begin() == m.end());
+    }
+
+    /*
+    * ==, !=, <, <=, > and >= on small random maps against std::map's,
+    * and elements handed out as value_type, whose key is const
+    */
+    void btreeCompare(void)
+    {
+        for (int i = 0; i < 400; i++)
+        {
+            BTree       a;
+            BTree       b;
+            StdIntMap   s;
+            StdIntMap   t;
+            int         k;
+
+            for (unsigned n = random(6); n > 0; n--)
+            {
+                k = static_cast<int>(random(4));
+                a[k] = k % 2;
+                s[k] = k % 2;
+            }
+            for (unsigned n = random(6); n > 0; n--)
+            {
+                k = static_cast<int>(random(4));
+                b[k] = static_cast<int>(random(2));
+                t[k] = b[k];
+            }
+            CHECK((a == b) == (s == t) && (a != b) == (s != t));
+            CHECK((a < b) == (s < t) && (a <= b) == (s <= t));
+            CHECK((a > b) == (s > t) && (a >= b) == (s >= t));
+            if (!a.empty())
+            {
+                BTree::value_type&          front = *a.begin();
+                const BTree::value_type&    back = *static_cast<const BTree&>(a).rbegin();
+
+                front._second = 7;
+                CHECK(a.begin()->_second == 7 && back._first == s.rbegin()->first);
+            }
+        }
+    }
+
+    /*
+    * ft::btree_map against std::map: random insertions (hinted or not),
+    * erasures of keys and of ranges, and lookups
+    */
+    void btreeMap(void)
+    {
+        std::vector<ft::pair<int, int> >    v;
+        StdIntMap                           s;
+
+        seed(9);
+        btreeRun<SmallBTree>(3000, 30000);
+        btreeRun<BTree>(20000, 30000);
+        for (int i = 0; i < 5000; i++)
+        {
+            v.push_back(ft::make_pair(i * 3, i));
+            s[i * 3] = i;
+        }
+
+        SmallBTree  bulk(v.begin(), v.end());
+        SmallBTree  copy;
+        SmallBTree  appended;
+
+        CHECK(sameMap(bulk, s));
+        copy = bulk;
+        copy.erase(copy.find(3), copy.find(3 * 4000));
+        CHECK(copy.size() == 1 + 1000);
+        CHECK(sameMap(bulk, s));
+        for (int i = 0; i < 5000; i++)
+        {
+            appended.insert(appended.end(), ft::make_pair(i * 3, i));
+        }
+        CHECK(sameMap(appended, s));
+        CHECK(appended == bulk && !(appended < bulk));
+        btreeCompare();
+    }
+}
@@ -0,0 +1,248 @@
+#if __cplusplus >= 201103L
+
+# include <map>
+# include <stdexcept>
+# include <thread>
+# include <vector>
+# include "../concurrent_map.hpp"
+# include "tests.hpp"
+
+namespace ft_test
+{
+    typedef ft::concurrent_map<int, int>    ConcurrentMap;
+    typedef std::map<int, int>              StdIntMap;
+
+    /*
+    * forward only: the skip list has no reverse iterators
+    */
+    bool sameOrder(const ConcurrentMap& m, const StdIntMap& s)
+    {
+        ConcurrentMap::const_iterator   it = m.begin();
+
+        if (m.size() != s.size())
+        {
+            return (false);
+        }
+        for (StdIntMap::const_iterator jt = s.begin(); jt != s.end(); ++it, ++jt)
+        {
+            if (it == m.end() || it->_first != jt->first || it->_second != jt->second)
+            {
+                return (false);
+            }
+        }
+        return (it == m.end());
+    }
+
+    /*
+    * one thread: every operation checked against std::map
+    */
+    void concurrentSerial(void)
+    {
+        ConcurrentMap   m;
+        StdIntMap       s;
+        int             k;
+        bool            thrown;
+
+        seed(20);
+        for (int i = 0; i < 6000; i++)
+        {
+            k = static_cast<int>(random(700));
+            switch (random(6))
+            {
+                case 0:
+                case 1:
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 2:
+                    CHECK(m.try_emplace(k, i)._second == s.insert(std::make_pair(k, i)).second);
+                    break ;
+                case 3:
+                    m[k] = i;
+                    s[k] = i;
+                    break ;
+                default:
+                    CHECK(m.insert(ft::make_pair(k, i))._second == s.insert(std::make_pair(k, i)).second);
+            }
+            k = static_cast<int>(random(710)) - 5;
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            if (m.lower_bound(k) != m.end())
+            {
+                CHECK(m.lower_bound(k)->_first == s.lower_bound(k)->first);
+            }
+            CHECK((m.upper_bound(k) == m.end()) == (s.upper_bound(k) == s.end()));
+            if (m.upper_bound(k) != m.end())
+            {
+                CHECK(m.upper_bound(k)->_first == s.upper_bound(k)->first);
+            }
+            thrown = false;
+            try
+            {
+                CHECK(m.at(k) == s.at(k));
+            }
+            catch (const std::out_of_range&)
+            {
+                thrown = true;
+            }
+            CHECK(thrown == (s.find(k) == s.end()));
+            if (i % 499 == 0)
+            {
+                CHECK(sameOrder(m, s));
+            }
+        }
+        CHECK(sameOrder(m, s));
+
+        ConcurrentMap   c(m);
+
+        CHECK(sameOrder(c, s));
+        c.erase(c.lower_bound(100), c.lower_bound(400));
+        s.erase(s.lower_bound(100), s.lower_bound(400));
+        CHECK(sameOrder(c, s));
+        m.swap(c);
+        CHECK(sameOrder(m, s));
+        m.clear();
+        CHECK(m.empty() && m.begin() == m.end());
+
+        ConcurrentMap::iterator it = m.insert(ft::make_pair(1, 1))._first;
+
+        m.erase(1);
+        m[1] = 2;
+        m.erase(it);
+        CHECK(m.size() == 1 && m.at(1) == 2);
+    }
+
+    /*
+    * each thread inserts and erases its own residue class of keys while
+    * reading the others', the result is checked against the union of
+    * the per-thread std::maps once every thread has joined
+    */
+    void concurrentWorker(ConcurrentMap* m, StdIntMap* s, int t, int threads)
+    {
+        unsigned    x = static_cast<unsigned>(t) * 2654435761u + 1;
+        int         k;
+
+        for (int i = 0; i < 20000; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            k = static_cast<int>(x % 4096);
+            if (k % threads != t)
+            {
+                m->find(k);
+                continue ;
+            }
+            if ((x >> 20) % 3 == 0)
+            {
+                m->erase(k);
+                s->erase(k);
+            }
+            else
+            {
+                m->insert(ft::make_pair(k, i));
+                s->insert(std::make_pair(k, i));
+            }
+        }
+    }
+
+    void concurrentThreads(void)
+    {
+        const int                   threads = 4;
+        ConcurrentMap               m;
+        std::vector<StdIntMap>      parts(threads);
+        std::vector<std::thread>    pool;
+        StdIntMap                   s;
+
+        for (int t = 0; t < threads; t++)
+        {
+            pool.push_back(std::thread(concurrentWorker, &m, &parts[t], t, threads));
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            pool[t].join();
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            s.insert(parts[t].begin(), parts[t].end());
+        }
+        CHECK(sameOrder(m, s));
+    }
+
+    /*
+    * every thread inserts and erases the same keys, through keys and
+    * through iterators; values are only written on insertion and always
+    * carry their key
+    */
+    void concurrentSharedWorker(ConcurrentMap* m, int t, int* bad)
+    {
+        unsigned                    x = static_cast<unsigned>(t) * 2654435761u + 7;
+        int                         k;
+        ConcurrentMap::iterator     it;
+
+        for (int i = 0; i < 20000; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            k = static_cast<int>(x % 256);
+            switch ((x >> 20) % 4)
+            {
+                case 0:
+                    m->erase(k);
+                    break ;
+                case 1:
+                    it = m->find(k);
+                    if (it != m->end())
+                    {
+                        *bad += (it->_second / 8 != k);
+                        m->erase(it);
+                    }
+                    break ;
+                default:
+                    it = m->try_emplace(k, k * 8 + t)._first;
+                    *bad += (it->_first != k || it->_second / 8 != k);
+            }
+        }
+    }
+
+    void concurrentShared(void)
+    {
+        const int                   threads = 4;
+        ConcurrentMap               m;
+        std::vector<int>            bad(threads, 0);
+        std::vector<std::thread>    pool;
+        StdIntMap                   s;
+
+        for (int t = 0; t < threads; t++)
+        {
+            pool.push_back(std::thread(concurrentSharedWorker, &m, t, &bad[t]));
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            pool[t].join();
+            CHECK(bad[t] == 0);
+        }
+        for (ConcurrentMap::const_iterator it = m.begin(); it != m.end(); ++it)
+        {
+            CHECK(s.empty() || s.rbegin()->first < it->_first);
+            CHECK(it->_second / 8 == it->_first);
+            s.insert(std::make_pair(it->_first, it->_second));
+        }
+        CHECK(sameOrder(m, s));
+        for (int k = 0; k < 256; k++)
+        {
+            CHECK(m.count(k) == s.count(k));
+        }
+        m.clear();
+        CHECK(m.empty() && m.size() == 0);
+    }
+
+    void concurrentMap(void)
+    {
+        concurrentSerial();
+        concurrentThreads();
+        concurrentShared();
+    }
+}
+
+#endif
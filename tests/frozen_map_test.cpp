@@ -0,0 +1,108 @@
+#include <map>
+#include <string>
+#include "../map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    /*
+    * every lookup of a frozen map against std::map, for keys present,
+    * between them and past both ends
+    */
+    template <class Frozen, class StdMap>
+    bool sameLookups(const Frozen& f, const StdMap& s, int lo, int hi)
+    {
+        bool    ok = sameMap(f, s);
+
+        for (int k = lo; k < hi && ok; k++)
+        {
+            ok = f.count(k) == s.count(k)
+                && (f.find(k) == f.end()) == (s.find(k) == s.end())
+                && (f.find(k) == f.end() || f.at(k) == s.find(k)->second)
+                && (f.lower_bound(k) == f.end()) == (s.lower_bound(k) == s.end())
+                && (f.lower_bound(k) == f.end() || f.lower_bound(k)->_first == s.lower_bound(k)->first)
+                && (f.upper_bound(k) == f.end()) == (s.upper_bound(k) == s.end())
+                && (f.upper_bound(k) == f.end() || f.upper_bound(k)->_first == s.upper_bound(k)->first)
+                && f.equal_range(k)._first == f.lower_bound(k);
+        }
+        return (ok);
+    }
+
+    /*
+    * freeze() at sizes around every power of two (the implicit tree gets
+    * one more level), the snapshot unaffected by later updates of the map,
+    * copies and assignment, and nothing left allocated
+    */
+    void frozenMap(void)
+    {
+        typedef ft::map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >   CountedMap;
+
+        long    before = liveBlocks;
+
+        seed(70);
+        {
+            typedef ft::frozen_map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >    Frozen;
+
+            CountedMap          m;
+            std::map<int, int>  s;
+            unsigned            keys;
+            int                 k;
+
+            for (int n = 0; n < 1100; n++)
+            {
+                keys = 3 * static_cast<unsigned>(n) + 3;
+                if (n < 20 || (n & (n - 1)) == 0 || (n & (n + 1)) == 0 || n % 97 == 0)
+                {
+                    std::map<int, int>  snap(s);
+                    Frozen              f = m.freeze();
+
+                    CHECK(f.size() == snap.size() && f.empty() == snap.empty());
+                    CHECK(sameLookups(f, snap, -2, static_cast<int>(keys) + 2));
+                    k = static_cast<int>(random(keys));
+                    m[k] = -1;
+                    s[k] = -1;
+                    k = static_cast<int>(random(keys));
+                    CHECK(m.erase(k) == s.erase(k));
+                    CHECK(sameLookups(f, snap, -2, static_cast<int>(keys) + 2));
+
+                    Frozen  g(f);
+
+                    CHECK(sameMap(g, snap));
+                    g = m.freeze();
+                    CHECK(sameMap(g, s));
+                    f = g;
+                    CHECK(sameMap(f, s) && sameMap(g, s));
+                }
+                do
+                {
+                    k = static_cast<int>(random(keys));
+                }
+                while (s.count(k) != 0);
+                m[k] = n;
+                s[k] = n;
+            }
+        }
+        CHECK(liveBlocks == before);
+
+        ft::map<std::string, int>       w;
+        std::map<std::string, int>      t;
+
+        for (int i = 0; i < 500; i++)
+        {
+            std::string     word(1 + random(5), static_cast<char>('a' + random(6)));
+
+            w[word] = i;
+            t[word] = i;
+        }
+
+        ft::frozen_map<std::string, int>    fw = w.freeze();
+
+        CHECK(sameMap(fw, t));
+        for (std::map<std::string, int>::iterator it = t.begin(); it != t.end(); ++it)
+        {
+            CHECK(fw.find(it->first) != fw.end() && fw.at(it->first) == it->second);
+            CHECK(fw.lower_bound(it->first + "a") == fw.upper_bound(it->first));
+        }
+        CHECK(fw.find("z") == fw.end() && fw.lower_bound("") == fw.begin());
+    }
+}
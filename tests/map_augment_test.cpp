@@ -0,0 +1,158 @@
+#include <map>
+#include <iterator>
+#include "../map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::order_statistics>  RankMap;
+    typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+        ft::monoid_augment<ft::sum_of<long> > >                                                               SumMap;
+
+    /*
+    * nth, rank and count_range against positions in std::map, through
+    * insertions, erasures and range erasures, then sizes and ranks of the
+    * pieces of a split
+    */
+    void mapOrderStatistics(void)
+    {
+        RankMap                 m;
+        std::map<int, int>      s;
+        int                     k;
+        int                     hi;
+        std::size_t             n;
+
+        seed(12);
+        for (int i = 0; i < 6000; i++)
+        {
+            k = static_cast<int>(random(2000));
+            if (random(3) == 0)
+            {
+                m.erase(k);
+                s.erase(k);
+            }
+            else if (i % 500 == 0)
+            {
+                m.erase(m.lower_bound(k), m.lower_bound(k + 40));
+                s.erase(s.lower_bound(k), s.lower_bound(k + 40));
+            }
+            else
+            {
+                m[k] = i;
+                s[k] = i;
+            }
+            k = static_cast<int>(random(2002)) - 1;
+            hi = k + static_cast<int>(random(300));
+            CHECK(m.rank(k) == static_cast<std::size_t>(std::distance(s.begin(), s.lower_bound(k))));
+            CHECK(m.count_range(k, hi) == static_cast<std::size_t>(std::distance(s.lower_bound(k), s.lower_bound(hi))));
+            CHECK(m.count_range(hi, k) == 0 || hi == k);
+            CHECK(m.aggregate(k, hi) == m.count_range(k, hi));
+            n = random(static_cast<unsigned>(s.size()) + 1);
+            if (n < s.size())
+            {
+                std::map<int, int>::iterator    jt = s.begin();
+
+                std::advance(jt, n);
+                CHECK(m.nth(n) != m.end() && m.nth(n)->_first == jt->first);
+            }
+            else
+            {
+                CHECK(m.nth(n) == m.end());
+            }
+        }
+        CHECK(sameMap(m, s));
+
+        std::map<int, int>  t(s.lower_bound(700), s.end());
+        std::map<int, int>  u(s.lower_bound(300), s.lower_bound(500));
+        RankMap             high = m.split(700);
+        RankMap             mid = m.extract_range(300, 500);
+
+        s.erase(s.lower_bound(700), s.end());
+        s.erase(s.lower_bound(300), s.lower_bound(500));
+        CHECK(sameMap(m, s) && sameMap(high, t) && sameMap(mid, u));
+        CHECK(high.rank(1000) == static_cast<std::size_t>(std::distance(t.begin(), t.lower_bound(1000))));
+        CHECK(mid.nth(mid.size()) == mid.end() && m.nth(m.size()) == m.end());
+        m.join(high);
+        m.join(mid);
+        s.insert(t.begin(), t.end());
+        s.insert(u.begin(), u.end());
+        CHECK(sameMap(m, s) && high.empty() && mid.empty());
+    }
+
+    long sumRange(const std::map<int, long>& s, int lo, int hi)
+    {
+        long    res = 0;
+
+        for (std::map<int, long>::const_iterator it = s.lower_bound(lo); it != s.end() && it->first < hi; ++it)
+        {
+            res += it->second;
+        }
+        return (res);
+    }
+
+    template <class T>
+    bool isConst(T&)
+    {
+        return (false);
+    }
+
+    template <class T>
+    bool isConst(const T&)
+    {
+        return (true);
+    }
+
+    /*
+    * sums over key ranges after structural changes and after values are
+    * changed in place through insert_or_assign and update, the only ways
+    * to change them: operator[], at() and iterators give const access
+    */
+    void mapAggregate(void)
+    {
+        SumMap                  m;
+        std::map<int, long>     s;
+        int                     k;
+        int                     hi;
+
+        seed(13);
+        for (int i = 0; i < 6000; i++)
+        {
+            k = static_cast<int>(random(1500));
+            switch (random(5))
+            {
+                case 0:
+                    m.erase(k);
+                    s.erase(k);
+                    break ;
+                case 1:
+                    m.insert_or_assign(k, i);
+                    s[k] = i;
+                    break ;
+                case 2:
+                    CHECK(m.update(k, -i) == (s.find(k) != s.end()));
+                    if (s.find(k) != s.end())
+                    {
+                        s[k] = -i;
+                    }
+                    break ;
+                default:
+                    m.insert(ft::make_pair(k, static_cast<long>(i)));
+                    s.insert(std::make_pair(k, static_cast<long>(i)));
+                    break ;
+            }
+            k = static_cast<int>(random(1502)) - 1;
+            hi = k + static_cast<int>(random(600));
+            CHECK(m.aggregate(k, hi) == sumRange(s, k, hi));
+        }
+        CHECK(m.aggregate(-1, 2000) == sumRange(s, -1, 2000));
+        for (std::map<int, long>::iterator it = s.begin(); it != s.end(); ++it)
+        {
+            it->second += 7;
+            m.insert_or_assign(it->first, it->second);
+        }
+        CHECK(m.aggregate(-1, 2000) == sumRange(s, -1, 2000));
+        CHECK(sameMap(m, s));
+        CHECK(isConst(m[3]) && isConst(m.at(3)) && isConst(m.begin()->_second) && isConst(m.rbegin()->_second));
+        CHECK(!isConst(RankMap()[3]));
+    }
+}
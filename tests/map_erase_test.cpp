@@ -0,0 +1,162 @@
+#include <map>
+#include "../map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    typedef ft::map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >   CountedMap;
+    typedef std::map<int, int>                                                                  StdIntMap;
+
+    /*
+    * iterator n steps from begin() in both maps
+    */
+    template <class Map>
+    typename Map::iterator nthIterator(Map& m, unsigned n)
+    {
+        typename Map::iterator  it = m.begin();
+
+        while (n-- > 0)
+        {
+            ++it;
+        }
+        return (it);
+    }
+
+    /*
+    * erase by iterator and by range (empty, single, from begin(), up to
+    * end(), everything) against std::map, the freed nodes reused by the
+    * following insertions and all given back at the end
+    */
+    void mapErase(void)
+    {
+        long    before = liveBlocks;
+
+        {
+            CountedMap      m;
+            StdIntMap       s;
+            unsigned        a;
+            unsigned        b;
+            int             k;
+
+            seed(60);
+            for (int i = 0; i < 4000; i++)
+            {
+                k = static_cast<int>(random(3000));
+                m[k] = i;
+                s[k] = i;
+                if (random(3) == 0 && !s.empty())
+                {
+                    a = random(static_cast<unsigned>(s.size()));
+                    m.erase(nthIterator(m, a));
+                    s.erase(nthIterator(s, a));
+                }
+                if (random(100) == 0)
+                {
+                    a = random(static_cast<unsigned>(s.size()) + 1);
+                    b = a + random(static_cast<unsigned>(s.size()) - a + 1);
+                    if (random(4) == 0)
+                    {
+                        a = (random(2) == 0) ? 0 : b;
+                    }
+                    if (random(4) == 0)
+                    {
+                        b = static_cast<unsigned>(s.size());
+                    }
+                    m.erase(nthIterator(m, a), nthIterator(m, b));
+                    s.erase(nthIterator(s, a), nthIterator(s, b));
+                    CHECK(sameMap(m, s));
+                }
+            }
+            CHECK(sameMap(m, s));
+            m.erase(m.begin(), m.end());
+            CHECK(m.empty() && m.size() == 0 && m.begin() == m.end());
+            m[1] = 1;
+            CHECK(m.size() == 1 && m.begin()->_first == 1);
+        }
+        CHECK(liveBlocks == before);
+    }
+
+    /*
+    * mapped value counting the copies and assignments made of it
+    */
+    struct Payload
+    {
+        static long     copies;
+
+        int             value;
+
+        Payload(void): value(0) {}
+
+        Payload(const Payload& x): value(x.value)
+        {
+            copies++;
+        }
+
+        Payload& operator=(const Payload& x)
+        {
+            copies++;
+            this->value = x.value;
+            return (*this);
+        }
+    };
+
+    long    Payload::copies = 0;
+
+    /*
+    * erasing an element neither moves, copies nor assigns any other one:
+    * iterators and pointers to the elements left stay valid and still
+    * see the same element
+    */
+    void mapEraseStability(void)
+    {
+        typedef ft::map<int, Payload>   PayloadMap;
+
+        PayloadMap                                  m;
+        std::map<int, PayloadMap::iterator>         where;
+        std::map<int, const Payload*>               address;
+        long                                        copies;
+        int                                         k;
+
+        seed(61);
+        for (int i = 0; i < 3000; i++)
+        {
+            k = static_cast<int>(random(5000));
+            m[k].value = k;
+        }
+        for (PayloadMap::iterator it = m.begin(); it != m.end(); ++it)
+        {
+            where[it->_first] = it;
+            address[it->_first] = &it->_second;
+        }
+        copies = Payload::copies;
+        for (int i = 0; i < 2000 && !where.empty(); i++)
+        {
+            k = static_cast<int>(random(5000));
+            if (random(2) == 0 && where.count(k) != 0)
+            {
+                m.erase(where[k]);
+            }
+            else
+            {
+                m.erase(k);
+            }
+            where.erase(k);
+            address.erase(k);
+            if (i % 400 == 0)
+            {
+                PayloadMap::iterator    lo = m.lower_bound(2000);
+
+                m.erase(lo, m.lower_bound(2100));
+                where.erase(where.lower_bound(2000), where.lower_bound(2100));
+                address.erase(address.lower_bound(2000), address.lower_bound(2100));
+            }
+        }
+        CHECK(Payload::copies == copies);
+        CHECK(m.size() == where.size());
+        for (std::map<int, PayloadMap::iterator>::iterator it = where.begin(); it != where.end(); ++it)
+        {
+            CHECK(it->second->_first == it->first && it->second->_second.value == it->first);
+            CHECK(&it->second->_second == address[it->first] && m.find(it->first) == it->second);
+        }
+    }
+}
@@ -0,0 +1,349 @@
+#include <functional>
+#include <iterator>
+#include <map>
+#include <vector>
+#include "../map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    /*
+    * key counting its constructions, ordered against plain ints by a
+    * transparent comparator
+    */
+    struct Id
+    {
+        static long     built;
+
+        int             value;
+
+        Id(void): value(0)
+        {
+            built++;
+        }
+
+        explicit Id(int v): value(v)
+        {
+            built++;
+        }
+
+        Id(const Id& x): value(x.value)
+        {
+            built++;
+        }
+    };
+
+    long    Id::built = 0;
+
+    struct IdLess
+    {
+        typedef void    is_transparent;
+
+        bool operator()(const Id& a, const Id& b) const
+        {
+            return (a.value < b.value);
+        }
+
+        bool operator()(const Id& a, int b) const
+        {
+            return (a.value < b);
+        }
+
+        bool operator()(int a, const Id& b) const
+        {
+            return (a < b.value);
+        }
+    };
+
+    typedef ft::map<Id, int, IdLess>    IdMap;
+
+    /*
+    * find, count, bounds and erase by int against std::map<int, int>,
+    * without building a single Id
+    */
+    void mapTransparent(void)
+    {
+        IdMap               m;
+        std::map<int, int>  s;
+        const IdMap&        c = m;
+        long                built;
+        int                 k;
+
+        seed(50);
+        for (int i = 0; i < 3000; i++)
+        {
+            k = static_cast<int>(random(1000));
+            m[Id(k)] = i;
+            s[k] = i;
+        }
+        built = Id::built;
+        for (int i = 0; i < 3000; i++)
+        {
+            k = static_cast<int>(random(1010)) - 5;
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.find(k) == m.end()) == (s.find(k) == s.end()));
+            CHECK((c.find(k) == c.end()) || c.find(k)->_second == s[k]);
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            if (m.lower_bound(k) != m.end())
+            {
+                CHECK(m.lower_bound(k)->_first.value == s.lower_bound(k)->first);
+            }
+            CHECK((c.upper_bound(k) == c.end()) == (s.upper_bound(k) == s.end()));
+            if (c.upper_bound(k) != c.end())
+            {
+                CHECK(c.upper_bound(k)->_first.value == s.upper_bound(k)->first);
+            }
+            CHECK(m.equal_range(k)._first == m.lower_bound(k) && c.equal_range(k)._second == c.upper_bound(k));
+            if (random(4) == 0)
+            {
+                CHECK(m.erase(k) == s.erase(k));
+            }
+        }
+        CHECK(Id::built == built);
+        CHECK(m.size() == s.size());
+        for (IdMap::iterator it = m.begin(); it != m.end(); ++it)
+        {
+            CHECK(s.count(it->_first.value) == 1 && s[it->_first.value] == it->_second);
+        }
+    }
+
+    /*
+    * comparator counting its calls
+    */
+    struct CountingLess
+    {
+        static long     calls;
+
+        bool operator()(int a, int b) const
+        {
+            calls++;
+            return (a < b);
+        }
+    };
+
+    long    CountingLess::calls = 0;
+
+    /*
+    * a walk over neighbouring keys compares a handful of keys per step,
+    * upwards and downwards, whatever the size of the map; const lookups
+    * start from the finger without moving it
+    */
+    void fingerCost(void)
+    {
+        const int                               n = 1 << 16;
+        ft::map<int, int, CountingLess>         m;
+        const ft::map<int, int, CountingLess>&  c = m;
+
+        for (int i = 0; i < n; i++)
+        {
+            m[2 * i] = i;
+        }
+        m.finger_search(true);
+        CountingLess::calls = 0;
+        for (int k = 0; k < 2 * n; k++)
+        {
+            CHECK(k == 2 * n - 1 || m.lower_bound(k)->_first == k + (k & 1));
+        }
+        CHECK(CountingLess::calls < 3L * 2 * n);
+        CountingLess::calls = 0;
+        for (int k = 2 * n - 1; k >= 0; k--)
+        {
+            CHECK(k == 2 * n - 1 || m.lower_bound(k)->_first == k + (k & 1));
+        }
+        CHECK(CountingLess::calls < 5L * 2 * n);
+        m.find(n);
+        CHECK(c.find(0) == c.begin() && c.find(2 * n - 2) == --c.end());
+        CountingLess::calls = 0;
+        m.find(n);
+        CHECK(CountingLess::calls <= 3);
+    }
+
+    /*
+    * finger mode and cursors on a workload of nearby keys (with jumps
+    * now and then), every step against std::map
+    * a cursor is dropped before the element it is on gets erased
+    */
+    void mapFinger(void)
+    {
+        ft::map<int, int>               m;
+        std::map<int, int>              s;
+        ft::map<int, int>::cursor       cur(m);
+        const ft::map<int, int>&        c = m;
+        int                             k = 0;
+
+        m.finger_search(true);
+        seed(51);
+        for (int i = 0; i < 20000; i++)
+        {
+            k += static_cast<int>(random(9)) - 4;
+            if (random(50) == 0)
+            {
+                k = static_cast<int>(random(4000)) - 2000;
+            }
+            switch (random(8))
+            {
+                case 0:
+                    if (cur.position() != m.end() && cur.position()->_first == k)
+                    {
+                        cur = ft::map<int, int>::cursor(m);
+                    }
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 1:
+                    m[k] = i;
+                    s[k] = i;
+                    break ;
+                case 2:
+                    CHECK(m.insert_or_assign(k, i)._second == (s.find(k) == s.end()));
+                    s[k] = i;
+                    break ;
+                case 3:
+                    CHECK(cur.insert(ft::make_pair(k, i))._second == s.insert(std::make_pair(k, i)).second);
+                    CHECK(cur.position()->_first == k && cur.position()->_second == s[k]);
+                    break ;
+                case 4:
+                    CHECK((cur.find(k) == m.end()) == (s.find(k) == s.end()));
+                    CHECK((cur.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+                    if (s.lower_bound(k) != s.end())
+                    {
+                        CHECK(cur.position()->_first == s.lower_bound(k)->first);
+                    }
+                    break ;
+                default:
+                    CHECK(m.try_emplace(k, i)._second == s.insert(std::make_pair(k, i)).second);
+            }
+            if (random(2) == 0 && cur.position() != m.end())
+            {
+                cur = ft::map<int, int>::cursor(m, m.find(cur.position()->_first));
+            }
+            k += static_cast<int>(random(5)) - 2;
+            CHECK(c.count(k) == s.count(k));
+            CHECK((c.lower_bound(k) == c.end()) == (s.lower_bound(k) == s.end()));
+            if (c.lower_bound(k) != c.end())
+            {
+                CHECK(c.lower_bound(k)->_first == s.lower_bound(k)->first);
+            }
+            CHECK((m.find(k) == m.end()) || m.find(k)->_second == s[k]);
+            if (random(200) == 0)
+            {
+                cur = ft::map<int, int>::cursor(m);
+            }
+        }
+        CHECK(sameMap(m, s));
+        m.finger_search(false);
+        m.erase(m.lower_bound(-100), m.lower_bound(100));
+        s.erase(s.lower_bound(-100), s.lower_bound(100));
+        m.finger_search(true);
+        for (k = -120; k < 120; k++)
+        {
+            CHECK(m.count(k) == s.count(k));
+        }
+        CHECK(sameMap(m, s));
+        fingerCost();
+    }
+
+    /*
+    * find_batch against one find per key, for batches of every length
+    * around the interleaving width, with missing and repeated keys
+    */
+    void mapFindBatch(void)
+    {
+        ft::map<int, int>                               m;
+        std::map<int, int>                              s;
+        const ft::map<int, int>&                        c = m;
+        std::vector<int>                                keys;
+        std::vector<ft::map<int, int>::iterator>        found;
+        std::vector<ft::map<int, int>::const_iterator>  cfound;
+
+        seed(52);
+        for (int i = 0; i < 20000; i++)
+        {
+            m[static_cast<int>(random(40000))] = i;
+        }
+        for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+        {
+            s[it->_first] = it->_second;
+        }
+        for (std::size_t n = 0; n < 100; n += 1 + n / 10)
+        {
+            keys.clear();
+            for (std::size_t i = 0; i < n; i++)
+            {
+                keys.push_back(random(8) == 0 && i > 0 ? keys[random(static_cast<unsigned>(i))] : static_cast<int>(random(40010)) - 5);
+            }
+            found.assign(n + 1, m.begin());
+            CHECK(m.find_batch(keys.begin(), keys.end(), found.begin()) == found.begin() + n);
+            CHECK(found[n] == m.begin());
+            cfound.clear();
+            c.find_batch(keys.begin(), keys.end(), std::back_inserter(cfound));
+            CHECK(cfound.size() == n);
+            for (std::size_t i = 0; i < n; i++)
+            {
+                CHECK(found[i] == m.find(keys[i]) && cfound[i] == c.find(keys[i]));
+                CHECK(found[i] == m.end() || found[i]->_second == s[keys[i]]);
+            }
+        }
+    }
+
+    /*
+    * arithmetic keys under std::less and std::greater take the direct
+    * descent, checked against std::map with the same order, negated keys
+    * give -0.0 for doubles, which has to find 0.0
+    */
+    template <class Key, class Compare>
+    void nativeRun(int steps, bool finger)
+    {
+        ft::map<Key, int, Compare>      m;
+        std::map<Key, int, Compare>     s;
+        Key                             k;
+
+        m.finger_search(finger);
+        for (int i = 0; i < steps; i++)
+        {
+            k = Key(static_cast<int>(random(600)) - 300) / Key(4);
+            if (random(5) == 0)
+            {
+                k = -k;
+            }
+            switch (random(4))
+            {
+                case 0:
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 1:
+                    CHECK(m.insert(m.lower_bound(k), ft::make_pair(k, i))->_first == s.insert(s.lower_bound(k), std::make_pair(k, i))->first);
+                    break ;
+                default:
+                    m[k] = i;
+                    s[k] = i;
+            }
+            k = Key(static_cast<int>(random(620)) - 310) / Key(4);
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.find(k) == m.end()) || m.find(k)->_second == s[k]);
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            if (m.lower_bound(k) != m.end())
+            {
+                CHECK(m.lower_bound(k)->_first == s.lower_bound(k)->first);
+            }
+            CHECK((m.upper_bound(k) == m.end()) == (s.upper_bound(k) == s.end()));
+            if (m.upper_bound(k) != m.end())
+            {
+                CHECK(m.upper_bound(k)->_first == s.upper_bound(k)->first);
+            }
+        }
+        CHECK(sameMap(m, s));
+    }
+
+    void mapNativeOrder(void)
+    {
+        seed(53);
+        nativeRun<int, std::less<int> >(6000, false);
+        nativeRun<int, std::greater<int> >(6000, false);
+        nativeRun<int, std::greater<int> >(6000, true);
+        nativeRun<unsigned char, std::less<unsigned char> >(3000, false);
+        nativeRun<long long, std::greater<long long> >(3000, false);
+        nativeRun<double, std::less<double> >(6000, false);
+        nativeRun<double, std::greater<double> >(6000, true);
+        nativeRun<float, std::greater<float> >(3000, false);
+    }
+}
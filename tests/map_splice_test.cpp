@@ -0,0 +1,303 @@
+#include <map>
+#include <vector>
+#include "../map.hpp"
+#include "tests.hpp"
+#if __cplusplus >= 201103L
+# include <thread>
+#endif
+
+namespace ft_test
+{
+    typedef ft::map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >   CountedMap;
+    typedef std::map<int, int>                                                                  StdIntMap;
+
+    /*
+    * the elements of s in [lo, hi) move to the returned map
+    */
+    StdIntMap takeRange(StdIntMap& s, int lo, int hi)
+    {
+        StdIntMap   res(s.lower_bound(lo), s.lower_bound(hi));
+
+        s.erase(s.lower_bound(lo), s.lower_bound(hi));
+        return (res);
+    }
+
+    void churnPiece(CountedMap* m, StdIntMap* s, int lo, int hi, unsigned seed)
+    {
+        unsigned    x = seed;
+        int         k;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            x = x * 1103515245u + 12345u;
+            k = lo + static_cast<int>((x >> 8) % static_cast<unsigned>(hi - lo));
+            if ((x >> 4) % 3 == 0)
+            {
+                m->erase(k);
+                s->erase(k);
+            }
+            else
+            {
+                (*m)[k] = i;
+                (*s)[k] = i;
+            }
+        }
+    }
+
+    /*
+    * keys of both maps interleave: x's elements are relinked, not copied,
+    * those whose key is in the map already are dropped
+    */
+    void joinInterleaved(void)
+    {
+        CountedMap                  a;
+        CountedMap                  b;
+        StdIntMap                   s;
+        std::map<int, const int*>   where;
+        int                         k;
+
+        for (int i = 0; i < 2000; i++)
+        {
+            k = static_cast<int>(random(6000));
+            a[k] = 0;
+            s[k] = 0;
+            k = static_cast<int>(random(6000));
+            b[k] = 1;
+        }
+        for (CountedMap::iterator it = b.begin(); it != b.end(); ++it)
+        {
+            if (s.insert(std::make_pair(it->_first, 1)).second)
+            {
+                where[it->_first] = &it->_second;
+            }
+        }
+        a.join(b);
+        CHECK(b.empty() && sameMap(a, s) && validTree(a) && validTree(b));
+        for (std::map<int, const int*>::iterator it = where.begin(); it != where.end(); ++it)
+        {
+            CHECK(&a.find(it->first)->_second == it->second);
+        }
+    }
+
+    /*
+    * split and extract_range pieces against std::map, updated on their
+    * own (on separate threads in c++11) once the map they came from is
+    * gone or not, then joined back, with interleaving keys or not
+    * splitting allocates nothing, joining no node (at most a slab header
+    * to hold a reference on x's storage), every slab is given back once
+    * the last piece is gone
+    */
+    void mapSplit(void)
+    {
+        long    before = liveBlocks;
+        long    total;
+
+        seed(40);
+        for (int round = 0; round < 30; round++)
+        {
+            CountedMap*                 m = new CountedMap;
+            StdIntMap                   s;
+            std::vector<CountedMap*>    pieces;
+            std::vector<StdIntMap>      expected;
+            int                         k;
+            int                         lo;
+            int                         hi;
+
+            for (unsigned n = random(3000); n > 0; n--)
+            {
+                k = static_cast<int>(random(5000));
+                (*m)[k] = k;
+                s[k] = k;
+            }
+            for (int i = 0; i < 6; i++)
+            {
+                lo = static_cast<int>(random(5200)) - 100;
+                hi = (random(2) == 0) ? 1 << 30 : lo + static_cast<int>(random(800));
+                pieces.push_back(new CountedMap);
+                total = totalBlocks;
+                if (hi == 1 << 30)
+                {
+                    m->split(lo).swap(*pieces.back());
+                }
+                else
+                {
+                    m->extract_range(lo, hi).swap(*pieces.back());
+                }
+                CHECK(totalBlocks == total);
+                expected.push_back(takeRange(s, lo, hi));
+                CHECK(sameMap(*m, s) && m->size() == s.size() && validTree(*m));
+                CHECK(sameMap(*pieces.back(), expected.back()) && validTree(*pieces.back()));
+            }
+            if (round % 2 == 0)
+            {
+                delete m;
+                m = NULL;
+            }
+#if __cplusplus >= 201103L
+            std::vector<std::thread>    threads;
+
+            for (std::size_t i = 0; i < pieces.size(); i++)
+            {
+                if (!pieces[i]->empty())
+                {
+                    threads.push_back(std::thread(churnPiece, pieces[i], &expected[i],
+                        pieces[i]->begin()->_first, pieces[i]->rbegin()->_first + 1, static_cast<unsigned>(i)));
+                }
+            }
+            for (std::size_t i = 0; i < threads.size(); i++)
+            {
+                threads[i].join();
+            }
+#else
+            for (std::size_t i = 0; i < pieces.size(); i++)
+            {
+                if (!pieces[i]->empty())
+                {
+                    churnPiece(pieces[i], &expected[i], pieces[i]->begin()->_first, pieces[i]->rbegin()->_first + 1, static_cast<unsigned>(i));
+                }
+            }
+#endif
+            for (std::size_t i = 0; i < pieces.size(); i++)
+            {
+                CHECK(sameMap(*pieces[i], expected[i]) && validTree(*pieces[i]));
+            }
+            for (std::size_t i = 1; i < pieces.size(); i++)
+            {
+                total = totalBlocks;
+                pieces[0]->join(*pieces[i]);
+                CHECK(totalBlocks <= total + 1);
+                expected[0].insert(expected[i].begin(), expected[i].end());
+                CHECK(pieces[i]->empty() && sameMap(*pieces[0], expected[0]) && validTree(*pieces[0]));
+                delete pieces[i];
+            }
+            if (m != NULL)
+            {
+                pieces[0]->join(*m);
+                expected[0].insert(s.begin(), s.end());
+                CHECK(m->empty() && sameMap(*pieces[0], expected[0]) && validTree(*pieces[0]));
+                delete m;
+            }
+            delete pieces[0];
+        }
+        CHECK(liveBlocks == before);
+        joinInterleaved();
+    }
+
+    CountedMap::insert_return_type insertHandle(CountedMap& m, CountedMap::node_type& nh)
+    {
+#if __cplusplus >= 201103L
+        return (m.insert(static_cast<CountedMap::node_type&&>(nh)));
+#else
+        return (m.insert(nh));
+#endif
+    }
+
+    /*
+    * extract without allocating, insert into another map (or back),
+    * handles outliving their map and merge, against std::map
+    */
+    void mapNodeHandle(void)
+    {
+        long    before = liveBlocks;
+        long    total;
+        bool    byKey;
+        int     k;
+
+        seed(41);
+        {
+            CountedMap*     a = new CountedMap;
+            CountedMap      b;
+            CountedMap      c;
+            StdIntMap       s;
+            StdIntMap       t;
+            StdIntMap       u;
+
+            for (int i = 0; i < 2000; i++)
+            {
+                k = static_cast<int>(random(3000));
+                (*a)[k] = k;
+                s[k] = k;
+            }
+            for (int i = 0; i < 500; i++)
+            {
+                k = static_cast<int>(random(3000));
+                b[k] = 0;
+                t[k] = 0;
+            }
+            for (int i = 0; i < 3000 && !a->empty(); i++)
+            {
+                k = static_cast<int>(random(3000));
+                byKey = (random(2) == 0);
+                total = totalBlocks;
+
+                CountedMap::node_type   nh = byKey ? a->extract(k) : a->extract(a->lower_bound(k) == a->end() ? a->begin() : a->lower_bound(k));
+
+                CHECK(totalBlocks == total);
+                CHECK(nh.empty() == (byKey && s.count(k) == 0));
+                if (nh.empty())
+                {
+                    continue ;
+                }
+                CHECK(s.count(nh.key()) == 1 && nh.mapped() == s[nh.key()]);
+                k = nh.key();
+                s.erase(k);
+                nh.mapped() = -k;
+
+                CountedMap::insert_return_type  res = insertHandle(random(4) == 0 ? *a : b, nh);
+
+                CHECK(nh.empty());
+                if (res.inserted)
+                {
+                    CHECK(res.node.empty() && res.position->_first == k && res.position->_second == -k);
+                    if (res.position == a->find(k))
+                    {
+                        s[k] = -k;
+                    }
+                    else
+                    {
+                        t[k] = -k;
+                    }
+                }
+                else
+                {
+                    CHECK(!res.node.empty() && res.node.key() == k && res.position->_first == k);
+                }
+                if (i % 500 == 0)
+                {
+                    CHECK(sameMap(*a, s) && sameMap(b, t));
+                }
+            }
+            CHECK(sameMap(*a, s) && sameMap(b, t));
+
+            CountedMap::node_type   kept = a->extract(a->begin());
+
+            k = kept.key();
+            delete a;
+            b.erase(k);
+            t.erase(k);
+            CHECK(insertHandle(b, kept).inserted && b.find(k) != b.end());
+            t[k] = s[k];
+            CHECK(sameMap(b, t));
+            for (int i = 0; i < 1000; i++)
+            {
+                k = static_cast<int>(random(3000));
+                c[k] = 1;
+                u[k] = 1;
+            }
+            c.merge(b);
+            for (StdIntMap::iterator it = t.begin(); it != t.end(); )
+            {
+                if (u.insert(*it).second)
+                {
+                    t.erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            CHECK(sameMap(c, u) && sameMap(b, t));
+        }
+        CHECK(liveBlocks == before);
+    }
+}
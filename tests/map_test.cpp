@@ -0,0 +1,565 @@
+#include <map>
+#include <string>
+#include <vector>
+#include "../map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    typedef ft::map<int, int>   IntMap;
+    typedef std::map<int, int>  StdIntMap;
+
+    /*
+    * random inserts and erases, every lookup checked against std::map
+    * on keys present and missing, below and above the stored range
+    */
+    void mapLookup(void)
+    {
+        IntMap      m;
+        StdIntMap   s;
+        int         k;
+
+        seed(1);
+        for (int i = 0; i < 4000; i++)
+        {
+            k = static_cast<int>(random(512));
+            if (random(3) == 0)
+            {
+                CHECK(m.erase(k) == s.erase(k));
+            }
+            else
+            {
+                CHECK(m.insert(ft::make_pair(k, i))._second == s.insert(std::make_pair(k, i)).second);
+            }
+            k = static_cast<int>(random(520)) - 4;
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.find(k) == m.end()) == (s.find(k) == s.end()));
+            if (m.find(k) != m.end())
+            {
+                CHECK(m.find(k)->_second == s.find(k)->second);
+                CHECK(m.at(k) == s.find(k)->second);
+            }
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            if (m.lower_bound(k) != m.end())
+            {
+                CHECK(m.lower_bound(k)->_first == s.lower_bound(k)->first);
+            }
+            CHECK((m.upper_bound(k) == m.end()) == (s.upper_bound(k) == s.end()));
+            if (m.upper_bound(k) != m.end())
+            {
+                CHECK(m.upper_bound(k)->_first == s.upper_bound(k)->first);
+            }
+            CHECK(m.equal_range(k)._first == m.lower_bound(k));
+            CHECK(m.equal_range(k)._second == m.upper_bound(k));
+        }
+        CHECK(sameMap(m, s));
+
+        const IntMap&   c = m;
+
+        for (k = -2; k < 516; k++)
+        {
+            CHECK((c.find(k) == c.end()) == (s.find(k) == s.end()));
+            CHECK((c.lower_bound(k) == c.end()) || !(c.lower_bound(k)->_first < k));
+        }
+    }
+
+    /*
+    * insert, operator[], the upserts and hinted insertion with hints
+    * right next to the key, far from it and at both ends
+    */
+    void mapInsert(void)
+    {
+        IntMap              m;
+        StdIntMap           s;
+        IntMap::iterator    hint;
+        int                 k;
+
+        seed(2);
+        for (int i = 0; i < 4000; i++)
+        {
+            k = static_cast<int>(random(1024));
+            switch (random(5))
+            {
+                case 0:
+                    m[k] += i;
+                    s[k] += i;
+                    break ;
+                case 1:
+                    CHECK(m.try_emplace(k, i)._second == s.insert(std::make_pair(k, i)).second);
+                    break ;
+                case 2:
+                    CHECK(m.insert_or_assign(k, i)._second == (s.find(k) == s.end()));
+                    s[k] = i;
+                    break ;
+                default:
+                    hint = m.begin();
+                    for (unsigned n = random(static_cast<unsigned>(m.size()) + 1); n > 0; n--)
+                    {
+                        ++hint;
+                    }
+                    if (random(2) == 0)
+                    {
+                        hint = m.lower_bound(k);
+                    }
+                    hint = m.insert(hint, ft::make_pair(k, i));
+                    s.insert(std::make_pair(k, i));
+                    CHECK(hint != m.end() && hint->_first == k && hint->_second == s[k]);
+                    break ;
+            }
+            CHECK(m.size() == s.size());
+        }
+        CHECK(sameMap(m, s));
+    }
+
+    /*
+    * every node comes from the map's allocator and goes back to it, an
+    * empty (or moved from) map holds no memory and a small one little
+    */
+    void mapAllocator(void)
+    {
+        typedef ft::map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >   CountedMap;
+
+        long    before = liveBlocks;
+        long    bytes = liveBytes;
+        long    total = totalBlocks;
+
+        {
+            CountedMap  e;
+            CountedMap  c(e);
+
+            CHECK(totalBlocks == total);
+            e[1] = 1;
+            CHECK(liveBlocks == before + 1 && liveBytes - bytes < 512);
+# if __cplusplus >= 201103L
+            CountedMap  moved(static_cast<CountedMap&&>(e));
+
+            CHECK(liveBlocks == before + 1 && e.empty() && moved.size() == 1);
+# endif
+        }
+        CHECK(liveBlocks == before);
+        {
+            CountedMap  m;
+            StdIntMap   s;
+            int         k;
+
+            m.reserve(100);
+            seed(3);
+            for (int i = 0; i < 5000; i++)
+            {
+                k = static_cast<int>(random(2048));
+                if (random(4) == 0)
+                {
+                    m.erase(k);
+                    s.erase(k);
+                }
+                else
+                {
+                    m[k] = i;
+                    s[k] = i;
+                }
+            }
+            CHECK(sameMap(m, s));
+
+            CountedMap  c(m);
+
+            CHECK(sameMap(c, s));
+            c.clear();
+            CHECK(c.empty());
+            CHECK(liveBlocks > before);
+        }
+        CHECK(totalBlocks > total);
+        CHECK(liveBlocks == before);
+    }
+
+    /*
+    * walks in both directions from begin(), end() and the middle, and
+    * the comparisons built on them
+    */
+    void mapIterators(void)
+    {
+        IntMap                      m;
+        StdIntMap                   s;
+        IntMap::iterator            it;
+        StdIntMap::iterator         jt;
+        IntMap::reverse_iterator    rit;
+
+        CHECK(m.begin() == m.end());
+        CHECK(m.rbegin() == m.rend());
+        seed(4);
+        for (int i = 0; i < 300; i++)
+        {
+            m[static_cast<int>(random(1000))] = i;
+        }
+        for (it = m.begin(); it != m.end(); ++it)
+        {
+            s[it->_first] = it->_second;
+        }
+        CHECK(sameMap(m, s));
+        it = m.end();
+        jt = s.end();
+        while (jt != s.begin())
+        {
+            --it;
+            --jt;
+            CHECK(it->_first == jt->first);
+        }
+        CHECK(it == m.begin());
+        it = m.find(s.begin()->first);
+        CHECK(it++ == m.begin());
+        CHECK(it-- != m.begin());
+        CHECK(it == m.begin());
+        rit = m.rbegin();
+        CHECK(rit->_first == s.rbegin()->first);
+        CHECK(rit.base() == m.end());
+        CHECK((++rit).base() == --m.end());
+
+        IntMap::const_iterator  cit = m.begin();
+        const IntMap&           c = m;
+
+        CHECK(cit == c.begin());
+        CHECK(c.rbegin()->_first == (--c.end())->_first);
+        it->_second = -1;
+        CHECK(cit->_second == -1);
+
+        IntMap  other(m);
+
+        CHECK(other == m);
+        CHECK(!(other < m) && other <= m && other >= m);
+        other[-1] = 0;
+        CHECK(other != m);
+        CHECK(other < m && m > other);
+        other.erase(-1);
+        other[s.rbegin()->first + 1] = 0;
+        CHECK(m < other && other >= m);
+    }
+
+    template <class T>
+    T valueOf(int i)
+    {
+        return (T(i));
+    }
+
+    template <>
+    std::string valueOf<std::string>(int i)
+    {
+        return (std::string(static_cast<std::size_t>(i % 40), 'x'));
+    }
+
+    /*
+    * long random runs of insertions and deletions, compared every few
+    * steps, with payloads of several sizes and alignments
+    */
+    template <class Key, class T>
+    void churn(unsigned keys, int steps)
+    {
+        ft::map<Key, T>     m;
+        std::map<Key, T>    s;
+        Key                 k;
+
+        for (int i = 0; i < steps; i++)
+        {
+            k = Key(random(keys));
+            if (random(5) < 2)
+            {
+                CHECK(m.erase(k) == s.erase(k));
+            }
+            else
+            {
+                m[k] = valueOf<T>(i);
+                s[k] = valueOf<T>(i);
+            }
+            if (i % 997 == 0)
+            {
+                CHECK(sameMap(m, s) && validTree(m));
+            }
+        }
+        CHECK(sameMap(m, s) && validTree(m));
+        while (!s.empty())
+        {
+            k = s.begin()->first;
+            CHECK(m.erase(k) == s.erase(k));
+            if (s.size() % 101 == 0)
+            {
+                CHECK(validTree(m));
+            }
+        }
+        CHECK(m.empty() && m.begin() == m.end());
+    }
+
+    /*
+    * the colour lives in the parent link: a node is its pair and three
+    * words, plus the subtree size with order statistics
+    */
+    void mapBalance(void)
+    {
+        CHECK(sizeof(ft::Node<long, long>) == sizeof(ft::pair<long, long>) + 3 * sizeof(void*));
+        CHECK(sizeof(ft::Node<int, int>) == sizeof(ft::pair<int, int>) + 3 * sizeof(void*));
+        CHECK(sizeof(ft::Node<long, long, ft::order_statistics>) == sizeof(ft::pair<long, long>) + 4 * sizeof(void*));
+        seed(5);
+        churn<char, char>(120, 20000);
+        churn<int, double>(5000, 40000);
+        churn<long, long>(100000, 40000);
+        churn<double, std::string>(300, 10000);
+    }
+
+    /*
+    * range construction and insertion, sorted (with repeated keys, where
+    * the first one wins) or not, into empty and non-empty maps
+    */
+    void mapBuild(void)
+    {
+        std::vector<ft::pair<int, int> >    v;
+        StdIntMap                           s;
+
+        seed(6);
+        for (int n = 0; n < 300; n += 1 + n / 4)
+        {
+            v.clear();
+            for (int i = 0; i < n; i++)
+            {
+                v.push_back(ft::make_pair(i - static_cast<int>(random(2)), i));
+            }
+            s.clear();
+            for (std::size_t i = 0; i < v.size(); i++)
+            {
+                s.insert(std::make_pair(v[i]._first, v[i]._second));
+            }
+
+            IntMap  sorted(v.begin(), v.end());
+
+            CHECK(sameMap(sorted, s) && validTree(sorted));
+            for (std::size_t i = 0; i + 1 < v.size(); i += 7)
+            {
+                std::swap(v[i], v[i + 1]);
+            }
+
+            IntMap      shuffled(v.begin(), v.end());
+            IntMap      half;
+            StdIntMap   h;
+
+            for (std::size_t i = 0; i < v.size(); i++)
+            {
+                h.insert(std::make_pair(v[i]._first, v[i]._second));
+            }
+            CHECK(sameMap(shuffled, h) && validTree(shuffled));
+            h.clear();
+            for (int i = 0; i < n; i += 3)
+            {
+                half[i] = -i;
+                h[i] = -i;
+            }
+            half.insert(v.begin(), v.end());
+            for (std::size_t i = 0; i < v.size(); i++)
+            {
+                h.insert(std::make_pair(v[i]._first, v[i]._second));
+            }
+            CHECK(sameMap(half, h) && validTree(half));
+            sorted.insert(half.begin(), half.end());
+            for (StdIntMap::iterator it = h.begin(); it != h.end(); ++it)
+            {
+                s.insert(*it);
+            }
+            CHECK(sameMap(sorted, s) && validTree(sorted));
+        }
+    }
+
+    /*
+    * mapped value counting its live instances
+    */
+    struct Tracked
+    {
+        static long     live;
+
+        int             value;
+
+        Tracked(void): value(0)
+        {
+            live++;
+        }
+
+        Tracked(const Tracked& x): value(x.value)
+        {
+            live++;
+        }
+
+        ~Tracked(void)
+        {
+            live--;
+        }
+
+        Tracked& operator=(const Tracked& x)
+        {
+            this->value = x.value;
+            return (*this);
+        }
+    };
+
+    long    Tracked::live = 0;
+
+    /*
+    * clear() and the destructor destroy every element exactly once
+    * (the header node holds a default constructed element of its own)
+    */
+    void mapClear(void)
+    {
+        {
+            ft::map<int, Tracked>   m;
+
+            seed(7);
+            for (int i = 0; i < 3000; i++)
+            {
+                m[static_cast<int>(random(5000))].value = i;
+            }
+            CHECK(Tracked::live == static_cast<long>(m.size()) + 1);
+            m.clear();
+            CHECK(Tracked::live == 1 && m.empty() && m.size() == 0);
+            m.clear();
+            for (int i = 0; i < 100; i++)
+            {
+                m[i].value = i;
+            }
+            CHECK(Tracked::live == 101 && m.begin()->_second.value == 0);
+        }
+        CHECK(Tracked::live == 0);
+    }
+
+    /*
+    * copies are independent of their source, swap and moves keep the
+    * elements (and iterators to them) where they are
+    */
+    void mapCopy(void)
+    {
+        IntMap              m;
+        StdIntMap           s;
+        IntMap::iterator    first;
+
+        seed(8);
+        for (int i = 0; i < 2000; i++)
+        {
+            m[static_cast<int>(random(3000))] = i;
+        }
+        for (IntMap::iterator it = m.begin(); it != m.end(); ++it)
+        {
+            s[it->_first] = it->_second;
+        }
+
+        IntMap  c(m);
+        IntMap  a;
+
+        CHECK(sameMap(c, s));
+        c[-1] = 0;
+        c.erase(s.begin()->first);
+        CHECK(sameMap(m, s));
+        a[5] = 5;
+        a = m;
+        CHECK(sameMap(a, s));
+        a = a;
+        CHECK(sameMap(a, s));
+        a.clear();
+        a = c;
+        CHECK(a == c && a != m);
+
+        IntMap  e;
+
+        first = m.begin();
+        m.swap(e);
+        CHECK(m.empty() && sameMap(e, s) && first == e.begin());
+        ft::swap(m, e);
+        CHECK(sameMap(m, s) && e.empty() && first == m.begin());
+        e = IntMap();
+        CHECK(e.empty());
+# if __cplusplus >= 201103L
+        IntMap  moved(static_cast<IntMap&&>(m));
+
+        CHECK(sameMap(moved, s) && first == moved.begin() && m.empty());
+        m = static_cast<IntMap&&>(moved);
+        CHECK(sameMap(m, s) && first == m.begin());
+        m[-5] = 1;
+        CHECK(m.size() == s.size() + 1);
+# endif
+    }
+
+    /*
+    * unite, intersect and subtract between maps of very different sizes
+    * (small ones are inserted, large ones split around), and sorted
+    * ranges spliced into non-empty maps, against std::map
+    */
+    void mapSetAlgebra(void)
+    {
+        typedef ft::map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >   CountedMap;
+
+        long    before = liveBlocks;
+
+        seed(9);
+        for (int sizes = 0; sizes < 40; sizes++)
+        {
+            CountedMap                          a;
+            CountedMap                          b;
+            StdIntMap                           s;
+            StdIntMap                           t;
+            StdIntMap                           res;
+            std::vector<ft::pair<int, int> >    v;
+            unsigned                            na = random(2) == 0 ? random(20) : random(3000);
+            unsigned                            nb = random(2) == 0 ? random(20) : random(3000);
+            int                                 k;
+
+            for (unsigned i = 0; i < na; i++)
+            {
+                k = static_cast<int>(random(4000));
+                a[k] = 1;
+                s[k] = 1;
+            }
+            for (unsigned i = 0; i < nb; i++)
+            {
+                k = static_cast<int>(random(4000));
+                b[k] = 2;
+                t[k] = 2;
+            }
+
+            CountedMap  u(a);
+            CountedMap  n(a);
+            CountedMap  d(a);
+
+            u.unite(b);
+            res = s;
+            res.insert(t.begin(), t.end());
+            CHECK(sameMap(u, res) && validTree(u));
+            n.intersect(b);
+            res.clear();
+            for (StdIntMap::iterator it = s.begin(); it != s.end(); ++it)
+            {
+                if (t.count(it->first) != 0)
+                {
+                    res.insert(*it);
+                }
+            }
+            CHECK(sameMap(n, res) && validTree(n));
+            d.subtract(b);
+            res = s;
+            for (StdIntMap::iterator it = t.begin(); it != t.end(); ++it)
+            {
+                res.erase(it->first);
+            }
+            CHECK(sameMap(d, res) && validTree(d));
+            CHECK(sameMap(b, t));
+            for (StdIntMap::iterator it = t.begin(); it != t.end(); ++it)
+            {
+                v.push_back(ft::make_pair(it->first, 3));
+                if (random(4) == 0)
+                {
+                    v.push_back(ft::make_pair(it->first, 4));
+                }
+            }
+            a.insert(v.begin(), v.end());
+            for (std::size_t i = 0; i < v.size(); i++)
+            {
+                s.insert(std::make_pair(v[i]._first, v[i]._second));
+            }
+            CHECK(sameMap(a, s) && validTree(a));
+            a.erase(a.begin(), a.lower_bound(2000));
+            s.erase(s.begin(), s.lower_bound(2000));
+            CHECK(sameMap(a, s) && validTree(a));
+        }
+        CHECK(liveBlocks == before);
+    }
+}
@@ -0,0 +1,123 @@
+#include <map>
+#include <vector>
+#include "../persistent_map.hpp"
+#include "tests.hpp"
+#if __cplusplus >= 201103L
+# include <thread>
+#endif
+
+namespace ft_test
+{
+    typedef ft::persistent_map<int, int, std::less<int>, counting_allocator<ft::pair<const int, int> > >    PersistentMap;
+    typedef std::map<int, int>                                                                              StdIntMap;
+
+#if __cplusplus >= 201103L
+    void walkSnapshot(PersistentMap snapshot, const StdIntMap* s, bool* same)
+    {
+        *same = sameMap(snapshot, *s);
+    }
+#endif
+
+    /*
+    * random updates with a snapshot (and a std::map copy of it) taken
+    * every few steps: every version still holds what it held when it
+    * was taken, whatever the map and the other versions did since,
+    * and every node is freed once the last version holding it is gone
+    * inserting a key already there copies nothing, iterators are a few
+    * words, not a whole path
+    */
+    void persistentMap(void)
+    {
+        long    before = liveBlocks;
+        long    total;
+
+        CHECK(sizeof(PersistentMap::const_iterator) <= 3 * sizeof(void*));
+
+        {
+            PersistentMap               m;
+            StdIntMap                   s;
+            std::vector<PersistentMap>  versions;
+            std::vector<StdIntMap>      expected;
+            int                         k;
+
+            seed(30);
+            for (int i = 0; i < 8000; i++)
+            {
+                k = static_cast<int>(random(900));
+                switch (random(5))
+                {
+                    case 0:
+                    case 1:
+                        CHECK(m.erase(k) == s.erase(k));
+                        break ;
+                    case 2:
+                        m[k] = i;
+                        s[k] = i;
+                        break ;
+                    case 3:
+                        CHECK(m.insert_or_assign(k, i)._second == (s.find(k) == s.end()));
+                        s[k] = i;
+                        CHECK(m.insert_or_assign(k, i)._first->_second == i);
+                        break ;
+                    default:
+                        CHECK(m.insert(ft::make_pair(k, i))._second == s.insert(std::make_pair(k, i)).second);
+                        total = totalBlocks;
+                        CHECK(m.insert(ft::make_pair(k, i))._first->_second == s[k] && m.size() == s.size());
+                        CHECK(totalBlocks == total);
+                }
+                k = static_cast<int>(random(910)) - 5;
+                CHECK(m.count(k) == s.count(k));
+                CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+                if (m.lower_bound(k) != m.end())
+                {
+                    CHECK(m.lower_bound(k)->_first == s.lower_bound(k)->first);
+                }
+                if (i % 250 == 0)
+                {
+                    versions.push_back(m.snapshot());
+                    expected.push_back(s);
+                    CHECK(versions.back() == m);
+                }
+                if (i % 1000 == 999)
+                {
+                    std::size_t     v = random(static_cast<unsigned>(versions.size()));
+
+                    versions[v].erase(k);
+                    expected[v].erase(k);
+                    versions[v][k + 1] = -i;
+                    expected[v][k + 1] = -i;
+                }
+            }
+            CHECK(sameMap(m, s));
+            for (std::size_t v = 0; v < versions.size(); v++)
+            {
+                CHECK(sameMap(versions[v], expected[v]));
+            }
+#if __cplusplus >= 201103L
+            PersistentMap   snapshot = m.snapshot();
+            StdIntMap       t(s);
+            bool            same = false;
+            std::thread     reader(walkSnapshot, snapshot, &t, &same);
+
+            for (int i = 0; i < 2000; i++)
+            {
+                k = static_cast<int>(random(900));
+                CHECK(m.erase(k) == s.erase(k));
+                k = static_cast<int>(random(900));
+                m[k] = -i;
+                s[k] = -i;
+            }
+            reader.join();
+            CHECK(same && sameMap(snapshot, t) && sameMap(m, s));
+#endif
+            versions.push_back(m.snapshot());
+            expected.push_back(s);
+            m.erase(m.lower_bound(100), m.upper_bound(700));
+            s.erase(s.lower_bound(100), s.upper_bound(700));
+            CHECK(sameMap(m, s) && sameMap(versions.back(), expected.back()));
+            m.clear();
+            CHECK(m.empty() && sameMap(versions.back(), expected.back()));
+        }
+        CHECK(liveBlocks == before);
+    }
+}
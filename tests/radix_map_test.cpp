@@ -0,0 +1,123 @@
+#include <map>
+#include <string>
+#include "../radix_map.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    typedef ft::radix_map<int, counting_allocator<ft::pair<const std::string, int> > >  RadixMap;
+    typedef std::map<std::string, int>                                                  StdStringMap;
+
+    /*
+    * keys sharing long prefixes, prefixes of one another, the empty key
+    * and bytes above 0x7f (which sort as unsigned char); a wide alphabet
+    * makes nodes grow to 256 children and shrink back
+    */
+    std::string radixKey(unsigned alphabet)
+    {
+        static const char*  prefixes[] = {"", "a", "ab", "abcdefghijklmnop", "abcdefghijklmnoq", "\xff\xfe", "b"};
+        std::string         res(prefixes[random(7)]);
+
+        for (unsigned n = random(4); n > 0; n--)
+        {
+            res += static_cast<char>(static_cast<int>(random(alphabet) * (256 / alphabet)) - 128);
+        }
+        return (res);
+    }
+
+    void radixRun(unsigned alphabet, int steps)
+    {
+        RadixMap        m;
+        StdStringMap    s;
+        std::string     k;
+
+        for (int i = 0; i < steps; i++)
+        {
+            k = radixKey(alphabet);
+            switch (random(6))
+            {
+                case 0:
+                case 1:
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 2:
+                    CHECK(m.insert(m.lower_bound(k), ft::make_pair(k, i))->_first == k);
+                    s.insert(std::make_pair(k, i));
+                    break ;
+                case 3:
+                    if (m.find(k) != m.end())
+                    {
+                        m.erase(m.find(k));
+                        s.erase(k);
+                    }
+                    break ;
+                default:
+                    m[k] = i;
+                    s[k] = i;
+            }
+            k = radixKey(alphabet);
+            CHECK(m.count(k) == s.count(k));
+            CHECK((m.find(k) == m.end()) || m.at(k) == s[k]);
+            CHECK((m.lower_bound(k) == m.end()) == (s.lower_bound(k) == s.end()));
+            if (m.lower_bound(k) != m.end())
+            {
+                CHECK(m.lower_bound(k)->_first == s.lower_bound(k)->first);
+            }
+            CHECK((m.upper_bound(k) == m.end()) == (s.upper_bound(k) == s.end()));
+            if (m.upper_bound(k) != m.end())
+            {
+                CHECK(m.upper_bound(k)->_first == s.upper_bound(k)->first);
+            }
+            if (i % 1000 == 0)
+            {
+                CHECK(sameMap(m, s));
+            }
+        }
+        CHECK(sameMap(m, s));
+
+        RadixMap    c(m);
+        RadixMap    a;
+
+        CHECK(sameMap(c, s));
+        a = c;
+        c.erase(c.begin(), c.lower_bound("b"));
+        s.erase(s.begin(), s.lower_bound("b"));
+        CHECK(sameMap(c, s) && a.size() == m.size());
+        a.swap(c);
+        CHECK(sameMap(a, s));
+        m.clear();
+        CHECK(m.empty() && m.begin() == m.end());
+    }
+
+    /*
+    * memory held for a handful of keys, and for a node that grew to 256
+    * children
+    */
+    void radixFootprint(void)
+    {
+        RadixMap    m;
+        long        bytes = liveBytes;
+
+        m["key"] = 1;
+        CHECK(liveBytes - bytes < 512);
+        for (int i = 0; i < 256; i++)
+        {
+            m[std::string(1, static_cast<char>(i))] = i;
+        }
+        CHECK(m.size() == 257 && liveBytes - bytes < 64 * 1024);
+        m.clear();
+        CHECK(liveBytes == bytes);
+    }
+
+    void radixMap(void)
+    {
+        long    before = liveBlocks;
+
+        seed(80);
+        radixRun(4, 6000);
+        radixRun(64, 10000);
+        radixRun(256, 20000);
+        radixFootprint();
+        CHECK(liveBlocks == before);
+    }
+}
@@ -0,0 +1,42 @@
+#include <iostream>
+#include "tests.hpp"
+
+namespace ft_test
+{
+    int                     failures = 0;
+#if __cplusplus >= 201103L
+    std::atomic<long>       liveBlocks(0);
+    std::atomic<long>       liveBytes(0);
+    std::atomic<long>       totalBlocks(0);
+#else
+    long                    liveBlocks = 0;
+    long                    liveBytes = 0;
+    long                    totalBlocks = 0;
+#endif
+
+    static unsigned long    state = 1;
+
+    void check(bool ok, const char* what, const char* file, int line)
+    {
+        if (ok)
+        {
+            return ;
+        }
+        if (++failures > 20)
+        {
+            return ;
+        }
+        std::cerr << file << ":" << line << ": check failed: " << what << std::endl;
+    }
+
+    void seed(unsigned long s)
+    {
+        state = s;
+    }
+
+    unsigned random(unsigned bound)
+    {
+        state = (state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        return (static_cast<unsigned>(state >> 8) % bound);
+    }
+}
@@ -0,0 +1,227 @@
+#ifndef TESTS_HPP
+# define TESTS_HPP
+
+# include <cstddef>
+# include <memory>
+# if __cplusplus >= 201103L
+#  include <atomic>
+# endif
+
+/*
+* differential checks: every suite drives an ft container and its
+* standard counterpart with the same pseudo-random operations and
+* compares them after each step
+* CHECK reports a failed condition and carries on, main returns non
+* zero when any of them failed
+*/
+
+# define CHECK(cond) ft_test::check((cond), #cond, __FILE__, __LINE__)
+
+namespace ft_test
+{
+    extern int  failures;
+
+    void        check(bool ok, const char* what, const char* file, int line);
+
+    /*
+    * deterministic, the same sequence on every run and platform
+    */
+    void        seed(unsigned long s);
+    unsigned    random(unsigned bound);
+
+    /*
+    * std::allocator keeping count of the blocks (and bytes) it has handed
+    * out and not taken back yet, shared by all its rebinds (and threads)
+    */
+# if __cplusplus >= 201103L
+    extern std::atomic<long>    liveBlocks;
+    extern std::atomic<long>    liveBytes;
+    extern std::atomic<long>    totalBlocks;
+# else
+    extern long     liveBlocks;
+    extern long     liveBytes;
+    extern long     totalBlocks;
+# endif
+
+    template <class T>
+    class counting_allocator: public std::allocator<T>
+    {
+    public:
+        typedef typename std::allocator<T>::pointer     pointer;
+        typedef typename std::allocator<T>::size_type   size_type;
+
+        template <class U>
+        struct rebind
+        {
+            typedef counting_allocator<U>   other;
+        };
+
+        counting_allocator(void) {}
+
+        counting_allocator(const counting_allocator& x): std::allocator<T>(x) {}
+
+        template <class U>
+        counting_allocator(const counting_allocator<U>& x): std::allocator<T>(x) {}
+
+        pointer allocate(size_type n, const void* hint = 0)
+        {
+            (void)hint;
+            liveBlocks++;
+            liveBytes += static_cast<long>(n * sizeof(T));
+            totalBlocks++;
+            return (std::allocator<T>::allocate(n));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            liveBlocks--;
+            liveBytes -= static_cast<long>(n * sizeof(T));
+            std::allocator<T>::deallocate(p, n);
+        }
+    };
+
+    /*
+    * same elements, in the same order, both ways
+    */
+    template <class FtMap, class StdMap>
+    bool sameMap(const FtMap& m, const StdMap& s)
+    {
+        typename FtMap::const_iterator              it = m.begin();
+        typename StdMap::const_iterator             jt = s.begin();
+        typename FtMap::const_reverse_iterator      rit = m.rbegin();
+        typename StdMap::const_reverse_iterator     rjt = s.rbegin();
+
+        if (m.size() != s.size())
+        {
+            return (false);
+        }
+        for (; jt != s.end(); ++it, ++jt)
+        {
+            if (it == m.end() || it->_first != jt->first || it->_second != jt->second)
+            {
+                return (false);
+            }
+        }
+        for (; rjt != s.rend(); ++rit, ++rjt)
+        {
+            if (rit == m.rend() || rit->_first != rjt->first)
+            {
+                return (false);
+            }
+        }
+        return (it == m.end() && rit == m.rend());
+    }
+
+    /*
+    * black height of the subtree under x, -1 when it breaks a red-black
+    * rule: a red node with a red parent, a child not pointing back at
+    * its parent or out of order with it, or two paths down with
+    * different black counts; count gets the number of nodes
+    */
+    template <class Node, class Compare>
+    int blackHeight(const Node* x, const Node* parent, const Compare& comp, std::size_t& count)
+    {
+        int     l;
+        int     r;
+
+        if (x == NULL)
+        {
+            return (1);
+        }
+        count++;
+        if (x->getParent() != parent || (x->getColor() && parent->getColor()))
+        {
+            return (-1);
+        }
+        if ((x->lChild != NULL && !comp(x->lChild->pair._first, x->pair._first))
+            || (x->rChild != NULL && !comp(x->pair._first, x->rChild->pair._first)))
+        {
+            return (-1);
+        }
+        l = blackHeight(x->lChild, x, comp, count);
+        r = blackHeight(x->rChild, x, comp, count);
+        if (l < 0 || l != r)
+        {
+            return (-1);
+        }
+        return (l + (x->getColor() ? 0 : 1));
+    }
+
+    /*
+    * red-black invariants under an ft::map header: a black root pointing
+    * back at it, the rules of blackHeight everywhere below, size nodes,
+    * and the header's links on the leftmost and rightmost ones (on
+    * itself when empty)
+    */
+    template <class Node, class Compare>
+    bool validHeader(const Node* header, const Compare& comp, std::size_t size)
+    {
+        const Node*     root = header->getParent();
+        const Node*     x = root;
+        std::size_t     count = 0;
+
+        if (root == NULL)
+        {
+            return (size == 0 && header->lChild == header && header->rChild == header);
+        }
+        if (root->getColor() || blackHeight(root, header, comp, count) < 0 || count != size)
+        {
+            return (false);
+        }
+        while (x->lChild != NULL)
+        {
+            x = x->lChild;
+        }
+        if (header->lChild != x)
+        {
+            return (false);
+        }
+        x = root;
+        while (x->rChild != NULL)
+        {
+            x = x->rChild;
+        }
+        return (header->rChild == x);
+    }
+
+    /*
+    * the tree of an ft::map, reached through the header its end() is on
+    */
+    template <class Map>
+    bool validTree(const Map& m)
+    {
+        return (validHeader(m.end().getNode(), m.key_comp(), m.size()));
+    }
+
+    void        mapLookup(void);
+    void        mapInsert(void);
+    void        mapAllocator(void);
+    void        mapIterators(void);
+    void        mapBalance(void);
+    void        mapBuild(void);
+    void        mapClear(void);
+    void        mapCopy(void);
+    void        mapSetAlgebra(void);
+    void        mapSplit(void);
+    void        mapNodeHandle(void);
+    void        mapTransparent(void);
+    void        mapFinger(void);
+    void        mapFindBatch(void);
+    void        mapNativeOrder(void);
+    void        mapErase(void);
+    void        mapEraseStability(void);
+    void        mapOrderStatistics(void);
+    void        mapAggregate(void);
+
+    void        btreeMap(void);
+    void        unorderedMap(void);
+    void        unorderedSet(void);
+    void        persistentMap(void);
+    void        frozenMap(void);
+    void        radixMap(void);
+# if __cplusplus >= 201103L
+    void        concurrentMap(void);
+# endif
+}
+
+#endif
@@ -0,0 +1,218 @@
+#include <map>
+#include <set>
+#include <string>
+#include "../unordered_map.hpp"
+#include "../unordered_set.hpp"
+#include "tests.hpp"
+
+namespace ft_test
+{
+    /*
+    * few distinct hashes: long probe sequences and plenty of collisions
+    */
+    struct PoorHash
+    {
+        std::size_t operator()(int k) const
+        {
+            return (static_cast<std::size_t>(k % 7));
+        }
+    };
+
+    /*
+    * same contents, whatever the order
+    */
+    template <class FtMap, class StdMap>
+    bool sameContents(const FtMap& m, const StdMap& s)
+    {
+        std::size_t                         n = 0;
+        typename StdMap::const_iterator     jt;
+
+        if (m.size() != s.size())
+        {
+            return (false);
+        }
+        for (typename FtMap::const_iterator it = m.begin(); it != m.end(); ++it, ++n)
+        {
+            jt = s.find(it->_first);
+            if (jt == s.end() || jt->second != it->_second)
+            {
+                return (false);
+            }
+        }
+        return (n == s.size());
+    }
+
+    /*
+    * it = m.erase(it) over the whole table: every element is reached, the
+    * ones erased exactly once, and nothing else is erased
+    */
+    template <class Map>
+    void eraseWhileIterating(Map& m, std::map<int, int>& s, int modulo)
+    {
+        std::map<int, int>  seen;
+
+        for (typename Map::iterator it = m.begin(); it != m.end();)
+        {
+            seen[it->_first]++;
+            if (it->_first % modulo == 0)
+            {
+                it = m.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        for (std::map<int, int>::iterator it = s.begin(); it != s.end();)
+        {
+            CHECK(seen.count(it->first) == 1);
+            CHECK(it->first % modulo != 0 || seen[it->first] == 1);
+            if (it->first % modulo == 0)
+            {
+                s.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        CHECK(sameContents(m, s));
+    }
+
+    template <class Map>
+    void unorderedRun(unsigned keys, int steps)
+    {
+        Map                     m;
+        std::map<int, int>      s;
+        int                     k;
+
+        for (int i = 0; i < steps; i++)
+        {
+            k = static_cast<int>(random(keys));
+            switch (random(6))
+            {
+                case 0:
+                case 1:
+                    CHECK(m.erase(k) == s.erase(k));
+                    break ;
+                case 2:
+                    CHECK(m.insert(ft::make_pair(k, i))._second == s.insert(std::make_pair(k, i)).second);
+                    break ;
+                case 3:
+                    m.insert_or_assign(k, i);
+                    s[k] = i;
+                    break ;
+                default:
+                    m[k] += i;
+                    s[k] += i;
+                    break ;
+            }
+            CHECK(m.size() == s.size());
+            k = static_cast<int>(random(keys));
+            CHECK(m.count(k) == s.count(k));
+            CHECK(m.find(k) == m.end() || m.find(k)->_second == s[k]);
+            if (i % 997 == 0)
+            {
+                CHECK(sameContents(m, s));
+            }
+        }
+        CHECK(sameContents(m, s));
+        m.rehash(4 * m.bucket_count());
+        CHECK(sameContents(m, s));
+        CHECK(m.load_factor() <= m.max_load_factor());
+        eraseWhileIterating(m, s, 3);
+
+        Map     c(m);
+
+        c.erase(c.begin(), c.end());
+        CHECK(c.empty() && c.begin() == c.end() && sameContents(m, s));
+    }
+
+    /*
+    * ft::unordered_map against std::map, with a good and a poor hash
+    */
+    void unorderedMap(void)
+    {
+        ft::unordered_map<std::string, int>     words;
+        std::map<std::string, int>              s;
+        std::string                             w;
+
+        seed(10);
+        unorderedRun<ft::unordered_map<int, int> >(5000, 40000);
+        unorderedRun<ft::unordered_map<int, int, PoorHash> >(300, 10000);
+        for (int i = 0; i < 3000; i++)
+        {
+            w = std::string(1 + random(6), static_cast<char>('a' + random(4)));
+            words[w]++;
+            s[w]++;
+        }
+        CHECK(sameContents(words, s));
+        words.reserve(10000);
+        CHECK(sameContents(words, s));
+    }
+
+    /*
+    * ft::unordered_set against std::set
+    */
+    void unorderedSet(void)
+    {
+        ft::unordered_set<int>                  m;
+        std::set<int>                           s;
+        std::size_t                             n = 0;
+        int                                     k;
+
+        seed(11);
+        for (int i = 0; i < 40000; i++)
+        {
+            k = static_cast<int>(random(3000));
+            if (random(3) == 0)
+            {
+                CHECK(m.erase(k) == s.erase(k));
+            }
+            else
+            {
+                CHECK(m.insert(k)._second == s.insert(k).second);
+            }
+            CHECK(m.size() == s.size());
+            CHECK(m.count(k) == s.count(k));
+        }
+        for (ft::unordered_set<int>::iterator it = m.begin(); it != m.end(); ++it, ++n)
+        {
+            CHECK(s.count(*it) == 1);
+        }
+        CHECK(n == s.size());
+        n = 0;
+        for (ft::unordered_set<int>::iterator it = m.begin(); it != m.end(); n++)
+        {
+            if (*it % 2 == 0)
+            {
+                it = m.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        CHECK(n >= s.size());
+        for (std::set<int>::iterator it = s.begin(); it != s.end();)
+        {
+            CHECK(m.count(*it) == static_cast<std::size_t>(*it % 2 != 0));
+            if (*it % 2 == 0)
+            {
+                s.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        CHECK(m.size() == s.size());
+
+        ft::unordered_set<int>  c(m);
+
+        c.erase(c.begin(), c.end());
+        CHECK(c.empty() && m.size() == s.size());
+        c.insert(m.begin(), m.end());
+        CHECK(c.size() == s.size());
+    }
+}
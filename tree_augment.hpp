@@ -0,0 +1,242 @@
+#ifndef TREE_AUGMENT_HPP
+# define TREE_AUGMENT_HPP
+
+# include <cstddef>
+# include <limits>
+
+/*
+* augmentation policies for the red-black tree
+* node_data is a base of every node, update() recomputes it from the node
+* and its children, the tree calls it bottom-up wherever a subtree changes
+* (attach, unlink, rotations, bulk build), enabled tells the tree whether
+* it has to do so at all, and reads_values whether node_data is computed
+* from the mapped values: maps then only hand those out as const
+* count() gives the number of nodes under x when the policy keeps it, and
+* std::size_t(-1) (unknown) otherwise
+* policies with an aggregate_type also describe how subtrees combine, for
+* range queries: identity(), lift() (a node alone), value() (a whole
+* subtree, identity for NULL) and an associative combine()
+*/
+
+namespace ft
+{
+    struct no_augment
+    {
+        typedef void        aggregate_type;
+
+        static const bool   enabled = false;
+        static const bool   reads_values = false;
+
+        struct node_data {};
+
+        template <class NodePtr>
+        static void update(NodePtr x)
+        {
+            (void)x;
+        }
+
+        template <class NodePtr>
+        static std::size_t count(NodePtr x)
+        {
+            (void)x;
+            return (static_cast<std::size_t>(-1));
+        }
+    };
+
+    /*
+    * subtree sizes, for rank / select queries
+    */
+    struct order_statistics
+    {
+        typedef std::size_t aggregate_type;
+
+        static const bool   enabled = true;
+        static const bool   reads_values = false;
+
+        struct node_data
+        {
+            std::size_t     size;
+
+            node_data(void): size(1) {}
+        };
+
+        template <class NodePtr>
+        static std::size_t size(NodePtr x)
+        {
+            return (x == NULL ? 0 : x->size);
+        }
+
+        template <class NodePtr>
+        static void update(NodePtr x)
+        {
+            x->size = 1 + size(x->lChild) + size(x->rChild);
+        }
+
+        template <class NodePtr>
+        static std::size_t count(NodePtr x)
+        {
+            return (size(x));
+        }
+
+        static aggregate_type identity(void)
+        {
+            return (0);
+        }
+
+        template <class NodePtr>
+        static aggregate_type lift(NodePtr x)
+        {
+            (void)x;
+            return (1);
+        }
+
+        template <class NodePtr>
+        static aggregate_type value(NodePtr x)
+        {
+            return (size(x));
+        }
+
+        static aggregate_type combine(aggregate_type a, aggregate_type b)
+        {
+            return (a + b);
+        }
+    };
+
+    /*
+    * caches, for every subtree, the combination of its elements in key order
+    * Monoid has to be default constructible and provide:
+    *   value_type                                  the aggregate
+    *   value_type identity(void) const
+    *   template <class Pair>
+    *   value_type lift(const Pair& x) const        one element (key, mapped)
+    *   value_type combine(a, b) const              associative
+    */
+    template <class Monoid>
+    struct monoid_augment
+    {
+        typedef Monoid                          monoid_type;
+        typedef typename Monoid::value_type     aggregate_type;
+
+        static const bool   enabled = true;
+        static const bool   reads_values = true;
+
+        struct node_data
+        {
+            aggregate_type  agg;
+
+            node_data(void): agg(Monoid().identity()) {}
+        };
+
+        static aggregate_type identity(void)
+        {
+            return (Monoid().identity());
+        }
+
+        template <class NodePtr>
+        static aggregate_type lift(NodePtr x)
+        {
+            return (Monoid().lift(x->pair));
+        }
+
+        template <class NodePtr>
+        static aggregate_type value(NodePtr x)
+        {
+            if (x == NULL)
+            {
+                return (Monoid().identity());
+            }
+            return (x->agg);
+        }
+
+        static aggregate_type combine(const aggregate_type& a, const aggregate_type& b)
+        {
+            return (Monoid().combine(a, b));
+        }
+
+        template <class NodePtr>
+        static void update(NodePtr x)
+        {
+            Monoid  m;
+
+            x->agg = m.combine(m.combine(value(x->lChild), m.lift(x->pair)), value(x->rChild));
+        }
+
+        template <class NodePtr>
+        static std::size_t count(NodePtr x)
+        {
+            (void)x;
+            return (static_cast<std::size_t>(-1));
+        }
+    };
+
+    /*
+    * common monoids over the mapped values
+    */
+    template <class V>
+    struct sum_of
+    {
+        typedef V   value_type;
+
+        value_type identity(void) const
+        {
+            return (value_type());
+        }
+
+        template <class Pair>
+        value_type lift(const Pair& x) const
+        {
+            return (x._second);
+        }
+
+        value_type combine(const value_type& a, const value_type& b) const
+        {
+            return (a + b);
+        }
+    };
+
+    template <class V>
+    struct min_of
+    {
+        typedef V   value_type;
+
+        value_type identity(void) const
+        {
+            return (std::numeric_limits<V>::max());
+        }
+
+        template <class Pair>
+        value_type lift(const Pair& x) const
+        {
+            return (x._second);
+        }
+
+        value_type combine(const value_type& a, const value_type& b) const
+        {
+            return (b < a ? b : a);
+        }
+    };
+
+    template <class V>
+    struct max_of
+    {
+        typedef V   value_type;
+
+        value_type identity(void) const
+        {
+            return (std::numeric_limits<V>::is_integer ? std::numeric_limits<V>::min() : -std::numeric_limits<V>::max());
+        }
+
+        template <class Pair>
+        value_type lift(const Pair& x) const
+        {
+            return (x._second);
+        }
+
+        value_type combine(const value_type& a, const value_type& b) const
+        {
+            return (a < b ? b : a);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
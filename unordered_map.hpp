@@ -0,0 +1,456 @@
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include <functional>
+# include <stdexcept>
+# include <iterator>
+# include <algorithm>
+# include "pair.hpp"
+# include "iterator_traits.hpp"
+# include "hash.hpp"
+# include "hash_table.hpp"
+# include "enable_if.hpp"
+# include "is_integral.hpp"
+
+/*
+* unordered map over the open addressing table of hash_table.hpp
+* elements live in the table itself, so unlike ft::map, rehashing and
+* erasing move them: iterators and references are invalidated by any
+* insertion that grows the table and by any erasure
+* erase(position) returns where to carry on from instead, erasing while
+* iterating is it = m.erase(it), never m.erase(it++) (see
+* HashTable::eraseAt)
+*/
+
+namespace ft
+{
+    template <class Key, class T, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class unordered_map
+    {
+    public:
+        typedef Key						key_type;
+		typedef T						mapped_type;
+		typedef ft::pair<const Key, T>	value_type;
+		typedef Hash					hasher;
+		typedef Pred					key_equal;
+		typedef Alloc					allocator_type;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t			difference_type;
+
+		typedef value_type&						reference;
+		typedef const value_type&				const_reference;
+		typedef typename Alloc::pointer			pointer;
+		typedef typename Alloc::const_pointer	const_pointer;
+
+    private:
+		struct KeyOfValue
+		{
+			const key_type& operator()(const value_type& x) const
+			{
+				return (x._first);
+			}
+		};
+
+    public:
+		typedef ft::HashTable<value_type, Key, KeyOfValue, Hash, Pred, Alloc>	table_type;
+
+		typedef typename table_type::iterator		iterator;
+		typedef typename table_type::const_iterator	const_iterator;
+
+    private:
+        allocator_type	_alloc;
+		table_type		_table;
+
+    public:
+        explicit unordered_map(size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+			const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+			_table(hf, eql, alloc)
+        {
+			if (n != 0)
+            {
+				this->_table.reserve(n);
+            }
+		}
+
+        template <class InputIterator>
+		unordered_map(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last,
+			size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type()):
+            _alloc(alloc),
+			_table(hf, eql, alloc)
+        {
+			if (n != 0)
+            {
+				this->_table.reserve(n);
+            }
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+        unordered_map(const unordered_map& x): _alloc(x._alloc), _table(x._table) {}
+
+		unordered_map& operator=(const unordered_map& x)
+        {
+		    if (this == &x)
+            {
+		    	return (*this);
+            }
+			this->_table = x._table;
+		    return (*this);
+		}
+
+# if __cplusplus >= 201103L
+		unordered_map(unordered_map&& x): _alloc(x._alloc), _table(x._table.hash_function(), x._table.key_eq(), x._alloc)
+        {
+			this->_table.swap(x._table);
+		}
+
+		unordered_map& operator=(unordered_map&& x)
+        {
+			this->swap(x);
+		    return (*this);
+		}
+# endif
+
+        ~unordered_map(void) {}
+
+        iterator begin(void)
+        {
+			return (this->_table.begin());
+		}
+
+		const_iterator begin(void) const
+        {
+			return (this->_table.begin());
+		}
+
+		iterator end(void)
+        {
+			return (this->_table.end());
+		}
+
+		const_iterator end(void) const
+        {
+			return (this->_table.end());
+		}
+
+        bool empty(void) const
+        {
+			return (this->_table.getSize() == 0);
+		}
+
+		size_type size(void) const
+        {
+			return (this->_table.getSize());
+		}
+
+		size_type max_size(void) const
+        {
+			return (this->_table.max_size());
+		}
+
+        mapped_type& operator[](const key_type& k)
+        {
+			return (this->try_emplace(k)._first->_second);
+		}
+
+		mapped_type& at(const key_type& k)
+        {
+			iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+		const mapped_type& at(const key_type& k) const
+        {
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				throw std::out_of_range("Out of Range");
+            }
+			return (it->_second);
+		}
+
+        ft::pair<iterator, bool> insert(const value_type& val)
+        {
+			return (this->_table.insertUnique(val));
+		}
+
+        iterator insert(const_iterator hint, const value_type& val)
+        {
+			(void)hint;
+			return (this->_table.insertUnique(val)._first);
+		}
+
+        template <class InputIterator>
+		void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+        {
+			this->insertRange(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k)
+        {
+			size_type						idx;
+			typename table_type::ctrl_type	h2;
+
+			if (this->_table.prepareInsert(k, idx, h2))
+            {
+				return (ft::make_pair(this->_table.iteratorAt(idx), false));
+            }
+			return (ft::make_pair(this->_table.constructAt(idx, h2, value_type(k, mapped_type())), true));
+		}
+
+		ft::pair<iterator, bool> try_emplace(const key_type& k, const mapped_type& obj)
+        {
+			size_type						idx;
+			typename table_type::ctrl_type	h2;
+
+			if (this->_table.prepareInsert(k, idx, h2))
+            {
+				return (ft::make_pair(this->_table.iteratorAt(idx), false));
+            }
+			return (ft::make_pair(this->_table.constructAt(idx, h2, value_type(k, obj)), true));
+		}
+
+		ft::pair<iterator, bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+        {
+			ft::pair<iterator, bool>	res = this->try_emplace(k, obj);
+
+			if (!res._second)
+            {
+				res._first->_second = obj;
+            }
+			return (res);
+		}
+
+        iterator erase(const_iterator position)
+        {
+			return (this->_table.eraseAt(this->_table.indexOf(position)));
+		}
+
+        size_type erase(const key_type& k)
+        {
+			return (this->_table.eraseKey(k));
+		}
+
+		/*
+		* erasing shifts elements around, the keys are collected first
+		*/
+        void erase(const_iterator first, const_iterator last)
+        {
+			typedef typename Alloc::template rebind<Key>::other	key_allocator_type;
+
+			key_allocator_type	keyAlloc(this->_alloc);
+			size_type			n = 0;
+			key_type*			keys;
+
+			if (first == this->begin() && last == this->end())
+            {
+				this->clear();
+				return ;
+            }
+			for (const_iterator it = first; it != last; ++it)
+            {
+				n++;
+            }
+			if (n == 0)
+            {
+				return ;
+            }
+			keys = keyAlloc.allocate(n);
+			for (size_type i = 0; i < n; i++, ++first)
+            {
+				keyAlloc.construct(keys + i, first->_first);
+            }
+			for (size_type i = 0; i < n; i++)
+            {
+				this->_table.eraseKey(keys[i]);
+				keyAlloc.destroy(keys + i);
+            }
+			keyAlloc.deallocate(keys, n);
+		}
+
+        void swap(unordered_map& x)
+        {
+			this->_table.swap(x._table);
+			std::swap(this->_alloc, x._alloc);
+		}
+
+        void clear(void)
+        {
+			this->_table.clear();
+		}
+
+		iterator find(const key_type& k)
+        {
+			return (this->_table.find(k));
+		}
+
+		const_iterator find(const key_type& k) const
+        {
+			return (this->_table.find(k));
+		}
+
+		size_type count(const key_type& k) const
+        {
+			return (this->_table.findIndex(k) == this->_table.getCapacity() ? 0 : 1);
+		}
+
+		ft::pair<iterator, iterator> equal_range(const key_type& k)
+        {
+			iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				return (ft::make_pair(it, it));
+            }
+			iterator	next = it;
+
+			return (ft::make_pair(it, ++next));
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+        {
+			const_iterator	it = this->find(k);
+
+			if (it == this->end())
+            {
+				return (ft::make_pair(it, it));
+            }
+			const_iterator	next = it;
+
+			return (ft::make_pair(it, ++next));
+		}
+
+		/*
+		* one slot per bucket
+		*/
+		size_type bucket_count(void) const
+        {
+			return (this->_table.getCapacity());
+		}
+
+		float load_factor(void) const
+        {
+			if (this->_table.getCapacity() == 0)
+            {
+				return (0);
+            }
+			return (static_cast<float>(this->size()) / this->_table.getCapacity());
+		}
+
+		float max_load_factor(void) const
+        {
+			return (0.875f);
+		}
+
+		void rehash(size_type n)
+        {
+			this->_table.rehash(n);
+		}
+
+		void reserve(size_type n)
+        {
+			this->_table.reserve(n);
+		}
+
+        hasher hash_function(void) const
+        {
+			return (this->_table.hash_function());
+		}
+
+		key_equal key_eq(void) const
+        {
+			return (this->_table.key_eq());
+		}
+
+        allocator_type get_allocator(void) const
+		{
+			return (this->_alloc);
+		}
+
+    private:
+		template <class InputIterator>
+		void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+        {
+			while (first != last)
+            {
+				this->_table.insertUnique(*first);
+				first++;
+			}
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+        {
+			this->insertSized(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::bidirectional_iterator_tag)
+        {
+			this->insertSized(first, last);
+		}
+
+		template <class ForwardIterator>
+		void insertRange(ForwardIterator first, ForwardIterator last, ft::random_access_iterator_tag)
+        {
+			this->insertSized(first, last);
+		}
+
+		/*
+		* the table is grown once up front instead of doubling along the way
+		*/
+		template <class ForwardIterator>
+		void insertSized(ForwardIterator first, ForwardIterator last)
+        {
+			size_type	n = 0;
+
+			for (ForwardIterator it = first; it != last; ++it)
+            {
+				n++;
+            }
+			this->_table.reserve(this->size() + n);
+			this->insertRange(first, last, std::input_iterator_tag());
+		}
+    };
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator==(const ft::unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const ft::unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+    {
+		typename ft::unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator	it;
+		typename ft::unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator	found;
+
+		if (lhs.size() != rhs.size())
+        {
+			return (false);
+        }
+		for (it = lhs.begin(); it != lhs.end(); ++it)
+        {
+			found = rhs.find(it->_first);
+			if (found == rhs.end() || !(found->_second == it->_second))
+            {
+				return (false);
+            }
+        }
+		return (true);
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator!=(const ft::unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const ft::unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+    {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	void swap(ft::unordered_map<Key, T, Hash, Pred, Alloc>& lhs, ft::unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+    {
+		lhs.swap(rhs);
+	}
+}
+
+#endif
\ No newline at end of file